@@ -0,0 +1,180 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+// compares the kind-tag casts (isa<>, dyn_cast<>) with dynamic_cast, in nanoseconds per cast, on a mix of
+// analyzer expressions and on a mix of codegen IR types
+// usage: benchmark-casting
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "vapor/analyzer/expressions/boolean.h"
+#include "vapor/analyzer/expressions/integer.h"
+#include "vapor/analyzer/expressions/pack.h"
+#include "vapor/analyzer/expressions/sized_integer.h"
+#include "vapor/analyzer/types/sized_integer.h"
+#include "vapor/codegen/ir/type.h"
+
+namespace
+{
+using namespace reaver::vapor;
+
+constexpr std::size_t node_count = 4096;
+constexpr std::size_t rounds = 1000;
+constexpr std::size_t iterations = 5;
+
+template<typename F>
+void measure(const char * name, F && f)
+{
+    auto best = std::chrono::steady_clock::duration::max();
+    std::size_t hits = 0;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        hits = 0;
+        for (std::size_t j = 0; j < rounds; ++j)
+        {
+            hits += f();
+        }
+        auto duration = std::chrono::steady_clock::now() - start;
+
+        best = std::min(best, duration);
+    }
+
+    auto nanoseconds = std::chrono::duration<double, std::nano>(best).count() / (node_count * rounds);
+
+    std::cout << std::left << std::setw(56) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(8) << nanoseconds << " ns/cast " << std::setw(12) << hits << " hits\n";
+}
+
+template<typename Container, typename F>
+std::size_t count_if(const Container & nodes, F && f)
+{
+    std::size_t ret = 0;
+    for (auto && node : nodes)
+    {
+        ret += f(node) ? 1 : 0;
+    }
+    return ret;
+}
+
+void run_analyzer()
+{
+    using namespace analyzer;
+
+    auto sized_type = make_sized_integer_type(32);
+
+    std::vector<std::unique_ptr<expression>> owned;
+    owned.reserve(node_count);
+    for (std::size_t i = 0; i < node_count; ++i)
+    {
+        boost::multiprecision::cpp_int value = i;
+
+        switch (i % 4)
+        {
+            case 0:
+                owned.push_back(std::make_unique<integer_constant>(value));
+                break;
+            case 1:
+                owned.push_back(std::make_unique<sized_integer_constant>(sized_type.get(), value));
+                break;
+            case 2:
+                owned.push_back(std::make_unique<boolean_constant>(i % 8 == 2));
+                break;
+            case 3:
+                owned.push_back(make_pack_expression());
+                break;
+        }
+    }
+
+    std::vector<const statement *> nodes;
+    nodes.reserve(node_count);
+    for (auto && expr : owned)
+    {
+        nodes.push_back(expr.get());
+    }
+
+    measure("statement -> expression, dynamic_cast", [&] {
+        return count_if(nodes, [](auto node) { return dynamic_cast<const expression *>(node); });
+    });
+    measure("statement -> expression, dyn_cast", [&] {
+        return count_if(nodes, [](auto node) { return dyn_cast<expression>(node); });
+    });
+
+    measure("statement -> sized_integer_constant, dynamic_cast", [&] {
+        return count_if(nodes, [](auto node) { return dynamic_cast<const sized_integer_constant *>(node); });
+    });
+    measure("statement -> sized_integer_constant, dyn_cast", [&] {
+        return count_if(nodes, [](auto node) { return dyn_cast<sized_integer_constant>(node); });
+    });
+
+    measure("expression::as<integer_constant>, dynamic_cast", [&] {
+        return count_if(owned, [](auto && expr) {
+            return dynamic_cast<const integer_constant *>(expr->_get_replacement());
+        });
+    });
+    measure("expression::as<integer_constant>, dyn_cast", [&] {
+        return count_if(owned, [](auto && expr) { return expr->template as<integer_constant>(); });
+    });
+}
+
+void run_codegen()
+{
+    using namespace codegen;
+
+    std::vector<std::shared_ptr<ir::type>> types;
+    types.reserve(node_count);
+    for (std::size_t i = 0; i < node_count; ++i)
+    {
+        switch (i % 3)
+        {
+            case 0:
+                types.push_back(ir::builtin_types().sized_integer(i % 64 + 1));
+                break;
+            case 1:
+                types.push_back(ir::builtin_types().function(ir::builtin_types().integer, {}));
+                break;
+            case 2:
+                types.push_back(std::make_shared<ir::user_type>());
+                break;
+        }
+    }
+
+    measure("ir::type -> ir::user_type, dynamic_cast", [&] {
+        return count_if(types, [](auto && type) { return dynamic_cast<const ir::user_type *>(type.get()); });
+    });
+    measure("ir::type -> ir::user_type, dyn_cast", [&] {
+        return count_if(types, [](auto && type) { return dyn_cast<ir::user_type>(type.get()); });
+    });
+}
+}
+
+int main()
+{
+    run_analyzer();
+    run_codegen();
+}
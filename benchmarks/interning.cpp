@@ -0,0 +1,155 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+// counts the allocations and bytes spent on integer values, comparing plain cpp_int with interned_integer,
+// for small and wide values, when the same constants are copied around many times and for a folding-like
+// stream of short lived intermediate values; also reports the size of the interning table during and after
+// each run
+// usage: benchmark-interning
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "vapor/interned_integer.h"
+
+namespace
+{
+std::size_t allocations = 0;
+std::size_t allocated_bytes = 0;
+}
+
+void * operator new(std::size_t size)
+{
+    ++allocations;
+    allocated_bytes += size;
+
+    if (auto ret = std::malloc(size ? size : 1))
+    {
+        return ret;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void * ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+using namespace reaver::vapor;
+
+constexpr std::size_t value_count = 1024;
+constexpr std::size_t copies = 64;
+constexpr std::size_t intermediates = 1000000;
+
+// 40 bit values are stored inline by interned_integer; 256 bit ones don't fit in cpp_int's inline storage
+// either
+constexpr std::size_t small_bits = 40;
+constexpr std::size_t wide_bits = 256;
+
+boost::multiprecision::cpp_int make_value(std::size_t i, std::size_t bits)
+{
+    boost::multiprecision::cpp_int ret = 1;
+    ret <<= bits;
+    return ret + i % value_count;
+}
+
+const boost::multiprecision::cpp_int & get(const boost::multiprecision::cpp_int & value)
+{
+    return value;
+}
+
+boost::multiprecision::cpp_int get(const interned_integer & value)
+{
+    return value.get();
+}
+
+template<typename F>
+void measure(const char * name, F && f)
+{
+    auto allocations_before = allocations;
+    auto bytes_before = allocated_bytes;
+
+    auto live_entries = f();
+
+    std::cout << std::left << std::setw(48) << name << std::right << std::setw(10)
+              << allocations - allocations_before << " allocations " << std::setw(10)
+              << allocated_bytes - bytes_before << " bytes " << std::setw(8) << live_entries
+              << " live entries " << std::setw(8) << interned_integer::table_size() << " entries after\n";
+}
+
+template<typename T>
+std::size_t copy_constants(std::size_t bits)
+{
+    std::vector<T> values;
+    values.reserve(value_count * copies);
+    for (std::size_t i = 0; i < value_count; ++i)
+    {
+        values.push_back(T{ make_value(i, bits) });
+    }
+    for (std::size_t i = value_count; i < value_count * copies; ++i)
+    {
+        values.push_back(values[i % value_count]);
+    }
+
+    return interned_integer::table_size();
+}
+
+template<typename T>
+std::size_t fold_intermediates(std::size_t bits)
+{
+    T accumulator{ make_value(0, bits) };
+    for (std::size_t i = 0; i < intermediates; ++i)
+    {
+        accumulator = T{ get(accumulator) + 1 };
+    }
+
+    return interned_integer::table_size();
+}
+
+template<typename T>
+void run(const char * type_name)
+{
+    for (auto bits : { small_bits, wide_bits })
+    {
+        auto suffix = std::string{ ", " } + std::to_string(bits) + " bits, " + type_name;
+        measure(("copying constants" + suffix).c_str(), [&] { return copy_constants<T>(bits); });
+        measure(("folding intermediates" + suffix).c_str(), [&] { return fold_intermediates<T>(bits); });
+    }
+}
+}
+
+int main()
+{
+    run<boost::multiprecision::cpp_int>("cpp_int");
+    run<interned_integer>("interned_integer");
+}
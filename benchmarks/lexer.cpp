@@ -0,0 +1,121 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+// measures the throughput of the lexer, in MB/s, with every scanner the CPU supports
+// usage: benchmark-lexer [files...]
+// without arguments, lexes a synthetic source resembling machine-generated Vapor code
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include "vapor/lexer.h"
+#include "vapor/lexer/detail/scan.h"
+
+namespace
+{
+std::string generate_source(std::size_t module_count)
+{
+    std::string ret;
+
+    for (std::size_t i = 0; i < module_count; ++i)
+    {
+        auto index = std::to_string(i);
+
+        ret += "/*\n";
+        for (std::size_t j = 0; j < 8; ++j)
+        {
+            ret += " * This file has been generated automatically. Do not edit it by hand.\n";
+        }
+        ret += " */\n\n";
+
+        ret += "module generated_module_number_" + index + "\n{\n";
+        for (std::size_t j = 0; j < 16; ++j)
+        {
+            auto name = "generated_function_with_a_rather_long_name_" + index + "_" + std::to_string(j);
+
+            ret += "    // " + name + " computes a constant\n";
+            ret += "    export function " + name + "(first_argument : int, second_argument : int)\n";
+            ret += "    {\n";
+            ret += "        return first_argument * 1234567890 + second_argument - 987654321;\n";
+            ret += "    }\n\n";
+        }
+        ret += "}\n\n";
+    }
+
+    return ret;
+}
+
+void run(const std::string & name, std::string_view source, std::size_t iterations)
+{
+    using namespace reaver::vapor::lexer;
+
+    for (auto scanner : available_scanners())
+    {
+        select_scanner(scanner);
+
+        auto best = std::chrono::steady_clock::duration::max();
+        std::size_t token_count = 0;
+
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            token_buffer tokens{ source, std::nullopt };
+            auto duration = std::chrono::steady_clock::now() - start;
+
+            best = std::min(best, duration);
+            token_count = tokens.size();
+        }
+
+        auto seconds = std::chrono::duration<double>(best).count();
+        auto megabytes = source.size() / (1024. * 1024.);
+
+        std::cout << std::left << std::setw(24) << name << std::setw(8) << scanner_name(scanner)
+                  << std::right << std::fixed << std::setprecision(2) << std::setw(10) << megabytes << " MB "
+                  << std::setw(10) << token_count << " tokens " << std::setw(10) << megabytes / seconds
+                  << " MB/s\n";
+    }
+}
+}
+
+int main(int argc, char ** argv)
+{
+    constexpr std::size_t iterations = 5;
+
+    if (argc < 2)
+    {
+        auto source = generate_source(1000);
+        run("<generated>", source, iterations);
+        return 0;
+    }
+
+    for (int i = 1; i < argc; ++i)
+    {
+        boost::iostreams::mapped_file_source source{ argv[i] };
+        run(argv[i], { source.data(), source.size() }, iterations);
+    }
+}
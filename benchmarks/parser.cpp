@@ -0,0 +1,156 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+// measures the throughput of the parser, in tokens per second, on synthetic sources built to stress the
+// expression parser (long chains of binary operators, deeply nested right-associative operators and calls)
+// and the parallel parsing of modules
+// usage: benchmark-parser [files...]
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include "vapor/lexer.h"
+#include "vapor/parser.h"
+
+namespace
+{
+std::string generate_long_chains(std::size_t declaration_count, std::size_t chain_length)
+{
+    const char * operators[] = { " + ", " * ", " - ", " / ", " << ", " < ", " == ", " & ", " || " };
+
+    std::string ret = "module long_chains\n{\n";
+    for (std::size_t i = 0; i < declaration_count; ++i)
+    {
+        ret += "    let value_" + std::to_string(i) + " = 1";
+        for (std::size_t j = 0; j < chain_length; ++j)
+        {
+            ret += operators[j % std::size(operators)];
+            ret += std::to_string(j);
+        }
+        ret += ";\n";
+    }
+    ret += "}\n";
+
+    return ret;
+}
+
+std::string generate_deep_chains(std::size_t declaration_count, std::size_t depth)
+{
+    std::string ret = "module deep_chains\n{\n";
+    for (std::size_t i = 0; i < declaration_count; ++i)
+    {
+        ret += "    let assigned_" + std::to_string(i) + " = a";
+        for (std::size_t j = 0; j < depth; ++j)
+        {
+            ret += " = a";
+        }
+        ret += ";\n";
+
+        ret += "    let called_" + std::to_string(i) + " = ";
+        for (std::size_t j = 0; j < depth; ++j)
+        {
+            ret += "f(-";
+        }
+        ret += "1";
+        ret += std::string(depth, ')');
+        ret += ";\n";
+    }
+    ret += "}\n";
+
+    return ret;
+}
+
+std::string generate_many_modules(std::size_t module_count)
+{
+    std::string ret;
+    for (std::size_t i = 0; i < module_count; ++i)
+    {
+        auto index = std::to_string(i);
+
+        ret += "module generated_" + index + "\n{\n";
+        for (std::size_t j = 0; j < 16; ++j)
+        {
+            ret += "    export function f" + std::to_string(j) + "(a : int, b : int) -> int\n";
+            ret += "    {\n";
+            ret += "        if (a < b) { return a * " + index + " + b - 1; }\n";
+            ret += "        return f" + std::to_string(j) + "(a - 1, b);\n";
+            ret += "    }\n";
+        }
+        ret += "}\n";
+    }
+
+    return ret;
+}
+
+void run(const std::string & name, std::string_view source, std::size_t iterations, std::size_t thread_count)
+{
+    using namespace reaver::vapor;
+
+    lexer::token_buffer tokens{ source, std::nullopt };
+
+    auto best = std::chrono::steady_clock::duration::max();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        auto ast = parser::parse_ast(tokens.begin(), tokens.end(), thread_count);
+        auto duration = std::chrono::steady_clock::now() - start;
+
+        best = std::min(best, duration);
+    }
+
+    auto seconds = std::chrono::duration<double>(best).count();
+
+    std::cout << std::left << std::setw(24) << name << std::right << std::setw(4) << thread_count
+              << " threads" << std::setw(10) << tokens.size()
+              << " tokens " << std::fixed << std::setprecision(2) << std::setw(10) << seconds * 1000 << " ms "
+              << std::setw(10) << tokens.size() / seconds / 1'000'000 << " Mtokens/s\n";
+}
+}
+
+int main(int argc, char ** argv)
+{
+    constexpr std::size_t iterations = 5;
+
+    if (argc < 2)
+    {
+        run("<long chains>", generate_long_chains(1000, 1000), iterations, 1);
+        run("<deep chains>", generate_deep_chains(1000, 200), iterations, 1);
+
+        auto modules = generate_many_modules(1000);
+        run("<many modules>", modules, iterations, 1);
+        run("<many modules>", modules, iterations, std::max(std::thread::hardware_concurrency(), 1u));
+        return 0;
+    }
+
+    for (int i = 1; i < argc; ++i)
+    {
+        boost::iostreams::mapped_file_source source{ argv[i] };
+        run(argv[i], { source.data(), source.size() }, iterations, 0);
+    }
+}
@@ -31,6 +31,7 @@
 #include "expressions/module.h"
 #include "helpers.h"
 #include "precontext.h"
+#include "vm/cache.h"
 
 namespace reaver::vapor::analyzer
 {
@@ -59,6 +60,9 @@ inline namespace _v1
 
         void serialize_to(std::ostream &) const;
 
+        void load_evaluation_cache(std::istream &);
+        void store_evaluation_cache(std::ostream &) const;
+
     private:
         parser::ast _original_ast;
         std::vector<std::unique_ptr<module>> _modules;
@@ -70,6 +74,7 @@ inline namespace _v1
         precontext _ctx;
 
         std::optional<boost::filesystem::path> _source_path;
+        vm::evaluation_cache _evaluation_cache;
     };
 
     std::ostream & operator<<(std::ostream & os, std::reference_wrapper<ast> tree);
@@ -35,11 +35,16 @@ inline namespace _v1
     {
     public:
         boolean_constant(bool value, ast_node parse = {})
-            : constant{ builtin_types().boolean.get() }, _value{ std::move(value) }
+            : constant{ kind::boolean_constant, builtin_types().boolean.get() }, _value{ std::move(value) }
         {
             _set_ast_info(parse);
         }
 
+        static bool classof(classof_tag<boolean_constant>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::boolean_constant;
+        }
+
         virtual void print(std::ostream & os, print_context ctx) const override
         {
             os << styles::def << ctx << styles::rule_name << "boolean-constant";
@@ -52,6 +57,13 @@ inline namespace _v1
             return _value;
         }
 
+        virtual std::size_t hash_value() const override
+        {
+            std::size_t seed = 0;
+            boost::hash_combine(seed, _value);
+            return seed;
+        }
+
     private:
         virtual future<> _analyze(analysis_context &) override
         {
@@ -86,7 +98,7 @@ inline namespace _v1
 
     inline std::unique_ptr<boolean_constant> make_boolean_constant(const parser::boolean_literal & parse)
     {
-        return std::make_unique<boolean_constant>(parse.value.string == U"true", make_node(parse));
+        return std::make_unique<boolean_constant>(parse.value.string == "true", make_node(parse));
     }
 }
 }
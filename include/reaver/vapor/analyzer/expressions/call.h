@@ -36,10 +36,16 @@ inline namespace _v1
         call_expression(function * fun,
             std::unique_ptr<expression> vtable_arg,
             std::vector<expression *> args)
-            : _function{ fun }, _vtable_arg{ std::move(vtable_arg) }, _args{ std::move(args) }
+            : call_expression{ kind::call_expression, fun, std::move(vtable_arg), std::move(args) }
         {
         }
 
+        static bool classof(classof_tag<call_expression>, const statement * stmt)
+        {
+            auto k = stmt->get_kind();
+            return k >= kind::call_expression && k <= kind::owning_call_expression;
+        }
+
         virtual void print(std::ostream &, print_context ctx) const override;
 
         void replace_with(std::unique_ptr<expression> expr)
@@ -53,6 +59,16 @@ inline namespace _v1
             }
         }
 
+        function * get_function() const
+        {
+            return _function;
+        }
+
+        const std::vector<expression *> & get_arguments() const
+        {
+            return _args;
+        }
+
         const range_type & get_range() const
         {
             return get_ast_info().value().range;
@@ -78,6 +94,17 @@ inline namespace _v1
         virtual std::unique_ptr<expression> _clone_expr(replacements & repl) const override;
 
     protected:
+        call_expression(kind k,
+            function * fun,
+            std::unique_ptr<expression> vtable_arg,
+            std::vector<expression *> args)
+            : expression{ k },
+              _function{ fun },
+              _vtable_arg{ std::move(vtable_arg) },
+              _args{ std::move(args) }
+        {
+        }
+
         virtual future<expression *> _simplify_expr(recursive_context) override;
 
     private:
@@ -105,13 +132,19 @@ inline namespace _v1
         owning_call_expression(function * fun,
             std::unique_ptr<expression> vtable_arg,
             std::vector<std::unique_ptr<expression>> args)
-            : call_expression{ fun,
+            : call_expression{ kind::owning_call_expression,
+                  fun,
                   std::move(vtable_arg),
                   fmap(args, [](auto && arg) { return arg.get(); }) },
               _var_exprs{ std::move(args) }
         {
         }
 
+        static bool classof(classof_tag<owning_call_expression>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::owning_call_expression;
+        }
+
     private:
         virtual future<expression *> _simplify_expr(recursive_context) override;
 
@@ -24,6 +24,7 @@
 
 #include <memory>
 
+#include <boost/functional/hash.hpp>
 #include <google/protobuf/any.pb.h>
 
 #include <reaver/prelude/monad.h>
@@ -60,13 +61,21 @@ inline namespace _v1
     class expression : public statement
     {
     public:
-        expression() = default;
+        expression() : statement{ kind::expression }
+        {
+        }
+
         virtual ~expression() = default;
 
-        expression(type * t) : _type{ t }
+        expression(type * t) : statement{ kind::expression }, _type{ t }
         {
         }
 
+        static bool classof(classof_tag<expression>, const statement * stmt)
+        {
+            return stmt->get_kind() >= kind::expression;
+        }
+
         type * get_type() const
         {
             if (!_type)
@@ -93,6 +102,8 @@ inline namespace _v1
     public:
         future<expression *> simplify_expr(recursive_context ctx)
         {
+            ctx.proper.record_use(ctx.user, this);
+            ctx.user = this;
             return ctx.proper.get_future_or_init(this, [&]() {
                 return make_ready_future()
                     .then([this, ctx]() { return _simplify_expr(ctx); })
@@ -200,7 +211,7 @@ inline namespace _v1
             return false;
         }
 
-        virtual expression * get_member(const std::u32string & name) const
+        virtual expression * get_member(interned_string name) const
         {
             auto repl = _get_replacement();
             if (repl == this)
@@ -219,13 +230,13 @@ inline namespace _v1
         template<typename T>
         T * as()
         {
-            return dynamic_cast<T *>(_get_replacement());
+            return dyn_cast<T>(_get_replacement());
         }
 
         template<typename T>
         const T * as() const
         {
-            return dynamic_cast<const T *>(_get_replacement());
+            return dyn_cast<T>(_get_replacement());
         }
 
         virtual std::size_t hash_value() const
@@ -293,6 +304,10 @@ inline namespace _v1
         }
 
     protected:
+        expression(kind k, type * t = nullptr) : statement{ k }, _type{ t }
+        {
+        }
+
         void _set_type(type * t)
         {
             assert((!_type) ^ (_type == t));
@@ -358,9 +373,10 @@ inline namespace _v1
         expression_context _expr_ctx;
     };
 
+    // hashes what the expression stands for, to agree with is_equal
     inline std::size_t hash_value(const expression & expr)
     {
-        return expr.hash_value();
+        return expr._get_replacement()->hash_value();
     }
 
     future<expression *> simplification_loop(analysis_context & ctx, std::unique_ptr<expression> & uptr);
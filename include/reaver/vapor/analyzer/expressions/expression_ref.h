@@ -31,10 +31,12 @@ inline namespace _v1
     class expression_ref : public expression
     {
     protected:
-        expression_ref() = default;
+        expression_ref(kind k) : expression{ k }
+        {
+        }
 
     public:
-        expression_ref(expression * expr) : _referenced{ expr }
+        expression_ref(expression * expr) : expression{ kind::expression_ref }, _referenced{ expr }
         {
             if (auto type = _referenced->try_get_type())
             {
@@ -42,6 +44,17 @@ inline namespace _v1
             }
         }
 
+        static bool classof(classof_tag<expression_ref>, const statement * stmt)
+        {
+            auto k = stmt->get_kind();
+            return k >= kind::expression_ref && k <= kind::identifier;
+        }
+
+        expression * get_referenced() const
+        {
+            return _referenced;
+        }
+
         virtual void print(std::ostream & os, print_context ctx) const override
         {
             os << styles::def << ctx << styles::rule_name << "expression-ref";
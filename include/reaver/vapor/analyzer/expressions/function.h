@@ -35,10 +35,15 @@ inline namespace _v1
     {
     public:
         function_expression(function * fun, function_type * type)
-            : expression{ type }, _fun{ fun }, _type{ type }
+            : expression{ kind::function_expression, type }, _fun{ fun }, _type{ type }
         {
         }
 
+        static bool classof(classof_tag<function_expression>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::function_expression;
+        }
+
         function * get_value() const
         {
             return _fun;
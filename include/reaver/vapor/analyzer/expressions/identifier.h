@@ -37,33 +37,43 @@ inline namespace _v1
     class identifier : public expression_ref
     {
     public:
-        identifier(std::u32string name, scope * lex_scope, ast_node parse_info)
-            : _lex_scope{ lex_scope }, _name{ std::move(name) }
+        identifier(interned_string name, scope * lex_scope, ast_node parse_info)
+            : expression_ref{ kind::identifier }, _lex_scope{ lex_scope }, _name{ name }
         {
             _set_ast_info(parse_info);
         }
 
-        const std::u32string & name() const
+        static bool classof(classof_tag<identifier>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::identifier;
+        }
+
+        interned_string name() const
         {
             return _name;
         }
 
         virtual void print(std::ostream & os, print_context ctx) const override;
 
+        // binds the identifier to the symbol it refers to; requires the lexical scope to be complete
+        void resolve();
+
     private:
         virtual future<> _analyze(analysis_context &) override;
 
         scope * _lex_scope;
-        std::u32string _name;
+        interned_string _name;
+        symbol * _symbol = nullptr;
     };
 
     struct precontext;
 
-    inline std::unique_ptr<identifier> preanalyze_identifier(precontext &,
+    std::unique_ptr<identifier> preanalyze_identifier(precontext & ctx,
         const parser::identifier & parse,
-        scope * lex_scope)
-    {
-        return std::make_unique<identifier>(parse.value.string, lex_scope, make_node(parse));
-    }
+        scope * lex_scope);
+
+    // binds all identifiers created by preanalysis so far; identifiers created after this bind themselves
+    // when they are analyzed
+    void resolve_identifiers(precontext & ctx);
 }
 }
@@ -22,7 +22,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <string_view>
 
 #include "entity.h"
 #include "expression.h"
@@ -30,6 +32,9 @@
 namespace reaver::vapor::proto
 {
 struct import_;
+class ast;
+class module;
+class symbol_entry;
 }
 
 namespace reaver::vapor::analyzer
@@ -97,10 +102,28 @@ namespace reaver::vapor::analyzer
 inline namespace _v1
 {
     struct precontext;
+    struct synthesized_udr;
+    class overload_set;
 
     std::unique_ptr<import_expression> preanalyze_import(precontext & ctx,
         const parser::import_expression & parse,
         scope * lex_scope,
         import_mode mode = import_mode::expression);
+
+    // bumped whenever the layout of module interface files changes
+    constexpr std::uint32_t interface_format_version = 1;
+
+    // interfaces written before the format was versioned read as version 0
+    bool is_supported_interface(const proto::ast & ast);
+
+    // the directory has to be strictly sorted by name for `find_symbol_entry` to work
+    bool is_sorted_symbol_directory(const proto::module & module);
+
+    // binary search in the sorted symbol directory of a module interface
+    const proto::symbol_entry * find_symbol_entry(const proto::module & module, std::string_view name);
+
+    // these create the imported entity on first use
+    expression * get_imported_entity(precontext & ctx, const synthesized_udr & udr);
+    std::shared_ptr<overload_set> get_imported_overload_set(precontext & ctx, const synthesized_udr & udr);
 }
 }
@@ -26,6 +26,7 @@
 
 #include <boost/multiprecision/integer.hpp>
 
+#include "../../interned_integer.h"
 #include "../../parser/literal.h"
 #include "constant.h"
 
@@ -37,25 +38,40 @@ inline namespace _v1
     {
     public:
         integer_constant(boost::multiprecision::cpp_int value, ast_node parse = {})
-            : constant{ builtin_types().integer.get() }, _value{ std::move(value) }
+            : integer_constant{ interned_integer{ value }, parse }
+        {
+        }
+
+        integer_constant(interned_integer value, ast_node parse = {})
+            : constant{ kind::integer_constant, builtin_types().integer.get() }, _value{ value }
         {
             _set_ast_info(parse);
         }
 
+        static bool classof(classof_tag<integer_constant>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::integer_constant;
+        }
+
         virtual void print(std::ostream & os, print_context ctx) const override
         {
             os << styles::def << ctx << styles::rule_name << "integer-constant";
             print_address_range(os, this);
-            os << ' ' << styles::string_value << _value << '\n';
+            os << ' ' << styles::string_value << _value.get() << '\n';
         }
 
-        const auto & get_value() const
+        auto get_value() const
         {
-            return _value;
+            return _value.get();
         }
 
         virtual std::unique_ptr<expression> convert_to(type * target) const override;
 
+        virtual std::size_t hash_value() const override
+        {
+            return std::hash<interned_integer>()(_value);
+        }
+
     private:
         virtual future<> _analyze(analysis_context &) override
         {
@@ -77,6 +93,7 @@ inline namespace _v1
         virtual bool _is_equal(const expression * rhs) const override
         {
             auto rhs_int = rhs->as<integer_constant>();
+            // interned, so equal values are the same entry
             return rhs_int && _value == rhs_int->_value;
         }
 
@@ -85,13 +102,13 @@ inline namespace _v1
             assert(0);
         }
 
-        boost::multiprecision::cpp_int _value;
+        interned_integer _value;
     };
 
     inline std::unique_ptr<integer_constant> make_integer_constant(const parser::integer_literal & parse)
     {
         return std::make_unique<integer_constant>(
-            boost::multiprecision::cpp_int{ utf8(parse.value.string) }, make_node(parse));
+            boost::multiprecision::cpp_int{ std::string{ parse.value.string } }, make_node(parse));
     }
 }
 }
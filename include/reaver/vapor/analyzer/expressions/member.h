@@ -33,14 +33,19 @@ inline namespace _v1
     class member_expression : public expression
     {
     public:
-        member_expression(type * parent_type, std::u32string name, type * own_type)
-            : expression{ own_type }, _parent{ parent_type }, _name{ std::move(name) }
+        member_expression(type * parent_type, interned_string name, type * own_type)
+            : expression{ kind::member_expression, own_type }, _parent{ parent_type }, _name{ name }
         {
         }
 
+        static bool classof(classof_tag<member_expression>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::member_expression;
+        }
+
         codegen::ir::member_variable member_codegen_ir(ir_generation_context & ctx) const;
 
-        const std::u32string & get_name() const
+        interned_string get_name() const
         {
             return _name;
         }
@@ -49,7 +54,7 @@ inline namespace _v1
         {
             os << styles::def << ctx << styles::rule_name << "member-expression";
             os << styles::def << " @ " << styles::address << this << styles::def << ": ";
-            os << styles::string_value << utf8(_name) << styles::def << '\n';
+            os << styles::string_value << _name.utf8() << styles::def << '\n';
 
             auto type_ctx = ctx.make_branch(false);
             os << styles::def << type_ctx << styles::subrule_name << "type:\n";
@@ -106,10 +111,10 @@ inline namespace _v1
         }
 
         type * _parent = nullptr;
-        std::u32string _name;
+        interned_string _name;
     };
 
-    inline auto make_member_expression(type * parent, std::u32string name, type * own_type)
+    inline auto make_member_expression(type * parent, interned_string name, type * own_type)
     {
         return std::make_unique<member_expression>(parent, std::move(name), own_type);
     }
@@ -33,17 +33,23 @@ inline namespace _v1
     class member_access_expression : public expression
     {
     public:
-        member_access_expression(ast_node parse, std::u32string name) : _name{ std::move(name) }
+        member_access_expression(ast_node parse, interned_string name)
+            : expression{ kind::member_access_expression }, _name{ name }
         {
             _set_ast_info(parse);
         }
 
-        member_access_expression(std::u32string name, type * referenced_type)
-            : expression{ referenced_type }, _name{ std::move(name) }
+        member_access_expression(interned_string name, type * referenced_type)
+            : expression{ kind::member_access_expression, referenced_type }, _name{ name }
         {
             assert(referenced_type);
         }
 
+        static bool classof(classof_tag<member_access_expression>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::member_access_expression;
+        }
+
         virtual void print(std::ostream & os, print_context) const override;
 
         auto get_name() const
@@ -63,8 +69,19 @@ inline namespace _v1
 
         void set_base_expression(expression * base);
 
+        const expression * get_base() const
+        {
+            return _base;
+        }
+
+        expression * get_referenced() const
+        {
+            return _referenced;
+        }
+
     private:
-        member_access_expression(ast_node parse, expression * referenced) : _referenced{ referenced }
+        member_access_expression(ast_node parse, expression * referenced)
+            : expression{ kind::member_access_expression }, _referenced{ referenced }
         {
             _set_ast_info(parse);
         }
@@ -118,7 +135,7 @@ inline namespace _v1
             assert(0);
         }
 
-        std::u32string _name;
+        interned_string _name;
 
         expression * _referenced = nullptr;
         mutable const expression * _base = nullptr;
@@ -146,10 +163,10 @@ inline namespace _v1
         const parser::member_expression & parse,
         scope *);
 
-    inline std::unique_ptr<member_access_expression> make_member_access_expression(std::u32string name,
+    inline std::unique_ptr<member_access_expression> make_member_access_expression(interned_string name,
         type * ref_type)
     {
-        return std::make_unique<member_access_expression>(std::move(name), ref_type);
+        return std::make_unique<member_access_expression>(name, ref_type);
     }
 }
 }
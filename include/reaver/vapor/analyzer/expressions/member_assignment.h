@@ -32,13 +32,19 @@ inline namespace _v1
     class member_assignment_expression : public expression
     {
     public:
-        member_assignment_expression(std::u32string member_name)
-            : _type{ make_member_assignment_type(std::move(member_name), this) }
+        member_assignment_expression(interned_string member_name)
+            : expression{ kind::member_assignment_expression },
+              _type{ make_member_assignment_type(member_name, this) }
         {
             _set_type(_type.get());
         }
 
-        const std::u32string member_name() const
+        static bool classof(classof_tag<member_assignment_expression>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::member_assignment_expression;
+        }
+
+        interned_string member_name() const
         {
             return _type->member_name();
         }
@@ -124,9 +130,9 @@ inline namespace _v1
         std::unique_ptr<member_assignment_type> _type;
     };
 
-    inline auto make_member_assignment_expression(std::u32string member_name)
+    inline auto make_member_assignment_expression(interned_string member_name)
     {
-        return std::make_unique<member_assignment_expression>(std::move(member_name));
+        return std::make_unique<member_assignment_expression>(member_name);
     }
 }
 }
@@ -38,6 +38,8 @@ inline namespace _v1
     class overload_set_expression_base : public expression
     {
     public:
+        using expression::expression;
+
         virtual void print(std::ostream & os, print_context) const override
         {
             assert(0);
@@ -60,11 +62,17 @@ inline namespace _v1
 
         // TODO: =default once I've thrown the analysis future nonsense out of this hierarchy
         // and into analysis_context
-        overload_set_expression(const overload_set_expression & other) : _oset{ other._oset }
+        overload_set_expression(const overload_set_expression & other)
+            : overload_set_expression_base{ kind::overload_set_expression }, _oset{ other._oset }
         {
             _set_type(_oset->get_type());
         }
 
+        static bool classof(classof_tag<overload_set_expression>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::overload_set_expression;
+        }
+
         virtual declaration_ir declaration_codegen_ir(ir_generation_context & ctx) const override;
 
         virtual void mark_exported() override
@@ -96,11 +104,17 @@ inline namespace _v1
 
         // TODO: =default once I've thrown the analysis future nonsense out of this hierarchy
         // and into analysis_context
-        refined_overload_set_expression(const refined_overload_set_expression & other) : _oset{ other._oset }
+        refined_overload_set_expression(const refined_overload_set_expression & other)
+            : overload_set_expression_base{ kind::refined_overload_set_expression }, _oset{ other._oset }
         {
             _set_type(_oset->get_type());
         }
 
+        static bool classof(classof_tag<refined_overload_set_expression>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::refined_overload_set_expression;
+        }
+
         virtual refined_overload_set * get_overload_set() const override
         {
             return _oset.get();
@@ -124,14 +138,15 @@ inline namespace _v1
         bool _is_exported = false;
     };
 
-    std::unique_ptr<overload_set_expression> create_overload_set(scope * lex_scope, std::u32string name);
+    std::unique_ptr<overload_set_expression> create_overload_set(scope * lex_scope, interned_string name);
     std::unique_ptr<refined_overload_set_expression> create_refined_overload_set(scope * lex_scope,
-        std::u32string name,
+        interned_string name,
         overload_set * base);
-    std::unique_ptr<overload_set_expression_base> get_overload_set(scope * lex_scope, std::u32string name);
-    std::unique_ptr<overload_set_expression> get_overload_set_special(scope * lex_scope, std::u32string name);
+    std::unique_ptr<overload_set_expression_base> get_overload_set(scope * lex_scope, interned_string name);
+    std::unique_ptr<overload_set_expression> get_overload_set_special(scope * lex_scope,
+        interned_string name);
     std::unique_ptr<refined_overload_set_expression> get_refined_overload_set(scope * lex_scope,
-        std::u32string name,
+        interned_string name,
         overload_set * base);
 }
 }
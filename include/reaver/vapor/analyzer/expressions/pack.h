@@ -36,9 +36,14 @@ inline namespace _v1
     {
     public:
         pack_expression(std::vector<expression *> exprs, type * pack_type)
-            : _exprs{ std::move(exprs) }, _type{ pack_type }
+            : pack_expression{ kind::pack_expression, std::move(exprs), pack_type }
         {
-            _set_type(_type);
+        }
+
+        static bool classof(classof_tag<pack_expression>, const statement * stmt)
+        {
+            auto k = stmt->get_kind();
+            return k >= kind::pack_expression && k <= kind::owning_pack_expression;
         }
 
         virtual void print(std::ostream &, print_context) const override
@@ -46,6 +51,24 @@ inline namespace _v1
             assert(0);
         }
 
+        virtual std::size_t hash_value() const override
+        {
+            std::size_t seed = 0;
+            boost::hash_combine(seed, _exprs.size());
+            for (auto && expr : _exprs)
+            {
+                boost::hash_combine(seed, *expr);
+            }
+            return seed;
+        }
+
+    protected:
+        pack_expression(kind k, std::vector<expression *> exprs, type * pack_type)
+            : expression{ k }, _exprs{ std::move(exprs) }, _type{ pack_type }
+        {
+            _set_type(_type);
+        }
+
     private:
         virtual std::unique_ptr<expression> _clone_expr(replacements & repl) const override
         {
@@ -65,7 +88,7 @@ inline namespace _v1
         virtual bool _is_equal(const expression * rhs) const override
         {
             auto rhs_pack = rhs->as<pack_expression>();
-            return _exprs.size() == rhs_pack->_exprs.size()
+            return rhs_pack && _exprs.size() == rhs_pack->_exprs.size()
                 && std::equal(
                        _exprs.begin(), _exprs.end(), rhs_pack->_exprs.begin(), [](auto && lhs, auto && rhs) {
                            return lhs->is_equal(rhs);
@@ -85,11 +108,18 @@ inline namespace _v1
     {
     public:
         owning_pack_expression(std::vector<std::unique_ptr<expression>> vars, type * pack_type)
-            : pack_expression{ fmap(vars, [](auto && var) { return var.get(); }), pack_type },
+            : pack_expression{ kind::owning_pack_expression,
+                  fmap(vars, [](auto && var) { return var.get(); }),
+                  pack_type },
               _vars{ std::move(vars) }
         {
         }
 
+        static bool classof(classof_tag<owning_pack_expression>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::owning_pack_expression;
+        }
+
     private:
         std::vector<std::unique_ptr<expression>> _vars;
     };
@@ -38,10 +38,25 @@ inline namespace _v1
             std::unique_ptr<expression> base,
             std::optional<lexer::token_type> mod,
             std::vector<std::unique_ptr<expression>> arguments,
-            std::optional<std::u32string> accessed_member);
+            std::optional<interned_string> accessed_member);
+
+        static bool classof(classof_tag<postfix_expression>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::postfix_expression;
+        }
 
         virtual void print(std::ostream & os, print_context ctx) const override;
 
+        expression * get_base() const
+        {
+            return _base_expr.get();
+        }
+
+        const std::optional<interned_string> & get_accessed_member() const
+        {
+            return _accessed_member;
+        }
+
         future<expression *> get_base_expression(analysis_context & ctx) const
         {
             return _base_expr->analyze(ctx).then([&] { return _base_expr.get(); });
@@ -85,7 +100,7 @@ inline namespace _v1
         std::vector<std::unique_ptr<expression>> _arguments;
         std::unique_ptr<expression> _call_expression;
 
-        std::optional<std::u32string> _accessed_member;
+        std::optional<interned_string> _accessed_member;
         std::optional<expression *> _referenced_expression;
     };
 }
@@ -26,6 +26,7 @@
 
 #include <boost/multiprecision/integer.hpp>
 
+#include "../../interned_integer.h"
 #include "../types/sized_integer.h"
 #include "constant.h"
 
@@ -37,15 +38,37 @@ inline namespace _v1
     {
     public:
         sized_integer_constant(sized_integer * type, boost::multiprecision::cpp_int value)
-            : constant{ type }, _value{ std::move(value) }, _type{ type }
+            : sized_integer_constant{ type, interned_integer{ value } }
         {
-            assert(_value <= _type->max_value());
-            assert(_value >= _type->min_value());
+        }
+
+        sized_integer_constant(sized_integer * type, int128 value)
+            : sized_integer_constant{ type, interned_integer{ value } }
+        {
+        }
+
+        sized_integer_constant(sized_integer * type, interned_integer value)
+            : constant{ kind::sized_integer_constant, type }, _value{ value }, _type{ type }
+        {
+            assert(_value.get() <= _type->max_value());
+            assert(_value.get() >= _type->min_value());
+        }
+
+        static bool classof(classof_tag<sized_integer_constant>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::sized_integer_constant;
         }
 
         auto get_value() const
         {
-            return _value;
+            return _value.get();
+        }
+
+        // every value of a type up to 128 bits wide is stored inline, and can be read without a conversion
+        int128 get_small_value() const
+        {
+            assert(_type->size() <= 128);
+            return _value.small_value();
         }
 
         virtual void print(std::ostream & os, print_context ctx) const override
@@ -53,14 +76,14 @@ inline namespace _v1
             os << styles::def << ctx << styles::rule_name << "sized-integer-constant(" << _type->size()
                << ")";
             print_address_range(os, this);
-            os << ' ' << styles::string_value << _value << '\n';
+            os << ' ' << styles::string_value << _value.get() << '\n';
         }
 
         virtual std::size_t hash_value() const override
         {
             std::size_t seed = 0;
             boost::hash_combine(seed, _type->size());
-            boost::hash_combine(seed, _value);
+            boost::hash_combine(seed, std::hash<interned_integer>()(_value));
             return seed;
         }
 
@@ -81,7 +104,7 @@ inline namespace _v1
                 return false;
             }
 
-            return other->get_value() == _value;
+            return other->_value == _value;
         }
 
         virtual std::unique_ptr<google::protobuf::Message> _generate_interface() const override
@@ -89,7 +112,7 @@ inline namespace _v1
             assert(0);
         }
 
-        boost::multiprecision::cpp_int _value;
+        interned_integer _value;
         sized_integer * _type;
     };
 }
@@ -33,7 +33,7 @@ inline namespace _v1
     {
     public:
         struct_expression(std::shared_ptr<struct_type> type, std::vector<std::unique_ptr<expression>> fields)
-            : expression{ type.get() }, _type{ type }
+            : expression{ kind::struct_expression, type.get() }, _type{ type }
         {
             auto members = _type->get_data_members();
 
@@ -48,6 +48,11 @@ inline namespace _v1
             }
         }
 
+        static bool classof(classof_tag<struct_expression>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::struct_expression;
+        }
+
         virtual bool is_constant() const override
         {
             return std::all_of(_fields_in_order.begin(), _fields_in_order.end(), [](auto && field) {
@@ -55,7 +60,7 @@ inline namespace _v1
             });
         }
 
-        virtual expression * get_member(const std::u32string & name) const override
+        virtual expression * get_member(interned_string name) const override
         {
             auto it = std::find_if(
                 _fields.begin(), _fields.end(), [&](auto && elem) { return elem.first->get_name() == name; });
@@ -89,6 +94,17 @@ inline namespace _v1
             }
         }
 
+        virtual std::size_t hash_value() const override
+        {
+            std::size_t seed = 0;
+            boost::hash_combine(seed, _type.get());
+            for (auto && field : _fields_in_order)
+            {
+                boost::hash_combine(seed, *field);
+            }
+            return seed;
+        }
+
     private:
         virtual std::unique_ptr<expression> _clone_expr(replacements & repl) const override
         {
@@ -99,7 +115,7 @@ inline namespace _v1
         virtual statement_ir _codegen_ir(ir_generation_context & ctx) const override
         {
             auto ir = fmap(_fields_in_order, [&](auto && field) { return field->codegen_ir(ctx); });
-            auto type = std::dynamic_pointer_cast<codegen::ir::user_type>(_type->codegen_type(ctx));
+            auto type = dyn_pointer_cast<codegen::ir::user_type>(_type->codegen_type(ctx));
             auto result = codegen::ir::struct_value{ std::move(type),
                 fmap(ir, [&](auto && field_ir) { return field_ir.back().result; }) };
 
@@ -118,7 +134,11 @@ inline namespace _v1
         virtual bool _is_equal(const expression * rhs) const override
         {
             auto rhs_struct = rhs->as<struct_expression>();
-            return rhs_struct && _type == rhs_struct->_type && _fields == rhs_struct->_fields;
+            return rhs_struct && _type == rhs_struct->_type
+                && std::equal(_fields_in_order.begin(),
+                       _fields_in_order.end(),
+                       rhs_struct->_fields_in_order.begin(),
+                       [](auto && lhs, auto && rhs) { return lhs->is_equal(rhs); });
         }
 
         virtual std::unique_ptr<google::protobuf::Message> _generate_interface() const override
@@ -49,14 +49,20 @@ inline namespace _v1
         }
 
     public:
-        type_expression(type * t, type_kind kind = type_kind::type) : constant{ _select(kind) }, _type{ t }
+        type_expression(type * t, type_kind tk = type_kind::type)
+            : constant{ kind::type_expression, _select(tk) }, _type{ t }
         {
         }
 
-        type_expression(type * t, type * base_type) : constant{ base_type }, _type{ t }
+        type_expression(type * t, type * base_type) : constant{ kind::type_expression, base_type }, _type{ t }
         {
         }
 
+        static bool classof(classof_tag<type_expression>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::type_expression;
+        }
+
         type * get_value() const
         {
             return _type;
@@ -64,6 +70,13 @@ inline namespace _v1
 
         virtual void print(std::ostream & os, print_context ctx) const override;
 
+        virtual std::size_t hash_value() const override
+        {
+            std::size_t seed = 0;
+            boost::hash_combine(seed, _type);
+            return seed;
+        }
+
     private:
         virtual std::unique_ptr<expression> _clone_expr(replacements &) const override;
         virtual constant_init_ir _constinit_ir(ir_generation_context & ctx) const override;
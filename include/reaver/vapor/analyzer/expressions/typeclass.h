@@ -36,6 +36,11 @@ inline namespace _v1
         typeclass_expression(ast_node parse, std::unique_ptr<typeclass> type);
         ~typeclass_expression();
 
+        static bool classof(classof_tag<typeclass_expression>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::typeclass_expression;
+        }
+
         virtual void print(std::ostream & os, print_context ctx) const override;
 
         typeclass * get_typeclass() const
@@ -49,7 +49,7 @@ inline namespace _v1
         virtual ~typeclass_instance_expression() override;
 
         virtual void print(std::ostream & os, print_context ctx) const override;
-        virtual expression * get_member(const std::u32string & name) const override;
+        virtual expression * get_member(interned_string name) const override;
 
         virtual declaration_ir declaration_codegen_ir(ir_generation_context & ctx) const override;
         virtual std::unordered_set<expression *> get_associated_entities() const override;
@@ -59,9 +59,9 @@ inline namespace _v1
         {
             logger::dlog(logger::trace) << "Replacing " << uptr.get() << " with " << ptr;
             logger::default_logger().sync();
+            ctx.something_happened(uptr.get());
             ctx.keep_alive(uptr.release());
             uptr.reset(ptr);
-            ctx.something_happened();
         }
     }
 
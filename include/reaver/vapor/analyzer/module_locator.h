@@ -0,0 +1,70 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+namespace reaver::vapor::analyzer
+{
+inline namespace _v1
+{
+    // finds module files in the module search paths
+    // every directory is listed at most once, and only the entries that match a module name are ever stat'ed;
+    // the results have to be invalidated whenever a compilation might have written new module files
+    class module_locator
+    {
+    public:
+        std::optional<boost::filesystem::path> find(const std::vector<boost::filesystem::path> & module_paths,
+            const std::vector<std::string> & module_name,
+            bool source_only = false);
+
+        void invalidate();
+
+    private:
+        using _name_iterator = std::vector<std::string>::const_iterator;
+
+        std::optional<boost::filesystem::path> _find(const boost::filesystem::path & module_path,
+            _name_iterator begin,
+            _name_iterator end,
+            bool source_only);
+
+        bool _is_directory(const boost::filesystem::path & dir, const std::string & name);
+        bool _is_regular_file(const boost::filesystem::path & dir, const std::string & name);
+        // null if there's no such entry
+        std::optional<boost::filesystem::file_type> * _entry(const boost::filesystem::path & dir,
+            const std::string & name);
+
+        std::mutex _lock;
+        // directory -> entry name -> entry type, filled in on first use
+        std::unordered_map<std::string,
+            std::unordered_map<std::string, std::optional<boost::filesystem::file_type>>>
+            _listings;
+    };
+}
+}
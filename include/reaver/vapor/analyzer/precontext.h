@@ -22,13 +22,18 @@
 
 #pragma once
 
+#include <mutex>
 #include <stack>
 
 #include <boost/filesystem.hpp>
+#include <google/protobuf/arena.h>
 
 #include "../config/compiler_options.h"
+#include "../source_manager.h"
 #include "expressions/entity.h"
+#include "module_locator.h"
 #include "semantic/context.h"
+#include "source_hashes.h"
 
 namespace reaver::vapor::proto
 {
@@ -42,6 +47,8 @@ inline namespace _v1
 {
     class unresolved_type;
     class overload_set;
+    class identifier;
+    class symbol;
 
     struct synthesized_udr
     {
@@ -74,6 +81,10 @@ inline namespace _v1
         std::unordered_map<synthesized_udr, std::shared_ptr<overload_set>, udr_hash, udr_compare>
             imported_overload_sets = {};
 
+        // symbols of imported modules; their entities are only created on first use
+        std::unordered_map<synthesized_udr, symbol *, udr_hash, udr_compare> imported_symbols = {};
+        std::recursive_mutex import_lock = {};
+
         std::unordered_map<const proto::user_defined_reference *,
             std::shared_ptr<unresolved_type>,
             udr_hash,
@@ -87,13 +98,23 @@ inline namespace _v1
         {
             boost::filesystem::path module_file_path;
             std::string_view source;
+            file_id source_file;
         };
 
         std::vector<module_paths> module_path_stack = {};
         std::vector<std::string> module_stack = {};
         std::string current_symbol = {};
 
-        std::vector<std::shared_ptr<proto::ast>> imported_asts = {};
+        module_locator locator = {};
+        source_hash_cache source_hashes = {};
+
+        // imported asts are allocated in these, and are alive for as long as their arenas are
+        std::vector<std::unique_ptr<google::protobuf::Arena>> import_arenas = {};
+
+        // identifiers waiting to be bound once their scopes are closed; only filled in before
+        // `resolve_identifiers` runs, which happens at the end of preanalysis, on a single thread
+        std::vector<identifier *> identifiers = {};
+        bool identifiers_resolved = false;
     };
 }
 }
@@ -22,6 +22,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+
 #include "../simplification/context.h"
 #include "signature.h"
 
@@ -62,6 +65,9 @@ inline namespace _v1
         {
         }
 
+        // branches of an if statement analyze in a copy of the enclosing context
+        analysis_context(const analysis_context & other);
+
         sized_integer * get_sized_integer_type(std::size_t size);
         function_type * get_function_type(function_signature sig);
         typeclass_type * get_typeclass_type(std::vector<type *> param_types);
@@ -69,10 +75,12 @@ inline namespace _v1
         std::shared_ptr<cached_results> results;
         std::shared_ptr<simplification_context> simplification_ctx;
 
-        bool entry_point_marked = false;
-        bool entry_variable_marked = false;
+        std::atomic<bool> entry_point_marked{ false };
+        std::atomic<bool> entry_variable_marked{ false };
 
     private:
+        // analysis runs on the default executor, so the type tables are shared between its threads
+        mutable std::mutex _types_lock;
         std::unordered_map<std::size_t, std::shared_ptr<sized_integer>> _sized_integers;
         std::unordered_map<function_signature, std::shared_ptr<function_type>> _function_types;
         std::unordered_map<std::vector<type *>,
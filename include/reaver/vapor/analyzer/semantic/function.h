@@ -34,6 +34,7 @@
 #include "../../range.h"
 #include "../ir_context.h"
 #include "../simplification/context.h"
+#include "../vm/bytecode.h"
 #include "context.h"
 
 namespace reaver::vapor::analyzer
@@ -172,6 +173,29 @@ inline namespace _v1
             _compile_time_eval = std::move(eval);
         }
 
+        void set_vm_intrinsic(vm::intrinsic intrinsic)
+        {
+            _vm_intrinsic = intrinsic;
+        }
+
+        const std::optional<vm::intrinsic> & get_vm_intrinsic() const
+        {
+            return _vm_intrinsic;
+        }
+
+        // the body lowered to bytecode; created and filled in by vm::lower
+        vm::bytecode_function * get_bytecode() const
+        {
+            return _bytecode.get();
+        }
+
+        vm::bytecode_function * make_bytecode()
+        {
+            assert(!_bytecode);
+            _bytecode = std::make_unique<vm::bytecode_function>();
+            return _bytecode.get();
+        }
+
         void set_parameters(std::vector<expression *> params)
         {
             _parameters = std::move(params);
@@ -241,6 +265,8 @@ inline namespace _v1
 
         std::vector<function_hook> _analysis_hooks;
         std::optional<function_eval> _compile_time_eval;
+        std::optional<vm::intrinsic> _vm_intrinsic;
+        std::unique_ptr<vm::bytecode_function> _bytecode;
         std::optional<scopes_generator> _scopes_generator;
 
         bool _entry = false;
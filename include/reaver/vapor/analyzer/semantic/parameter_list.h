@@ -38,9 +38,14 @@ inline namespace _v1
     class parameter : public expression
     {
     public:
-        parameter(ast_node parse, std::u32string name, std::unique_ptr<expression> type);
+        parameter(ast_node parse, interned_string name, std::unique_ptr<expression> type);
         ~parameter();
 
+        static bool classof(classof_tag<parameter>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::parameter;
+        }
+
         virtual void print(std::ostream & os, print_context ctx) const override;
 
         expression * get_type_expression() const
@@ -48,7 +53,7 @@ inline namespace _v1
             return _type_expression.get();
         }
 
-        const std::u32string & get_name() const
+        interned_string get_name() const
         {
             return _name;
         }
@@ -67,7 +72,7 @@ inline namespace _v1
         virtual constant_init_ir _constinit_ir(ir_generation_context &) const override;
         virtual std::unique_ptr<google::protobuf::Message> _generate_interface() const override;
 
-        std::u32string _name;
+        interned_string _name;
         std::unique_ptr<expression> _type_expression;
 
         std::unique_ptr<archetype> _archetype;
@@ -23,14 +23,16 @@
 #pragma once
 
 #include <memory>
-#include <shared_mutex>
 #include <string>
-#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <reaver/exception.h>
 #include <reaver/optional.h>
 
 #include "../../codegen/ir/scope.h"
+#include "../../interned_string.h"
 #include "../../utf.h"
 #include "../ir_context.h"
 
@@ -41,12 +43,12 @@ inline namespace _v1
     class failed_lookup : public exception
     {
     public:
-        failed_lookup(const std::u32string & n) : exception{ logger::error }, name{ n }
+        failed_lookup(interned_string n) : exception{ logger::error }, name{ n }
         {
-            *this << "failed scope lookup for `" << utf8(name) << "`.";
+            *this << "failed scope lookup for `" << name.utf8() << "`.";
         }
 
-        std::u32string name;
+        interned_string name;
     };
 
     class symbol;
@@ -104,27 +106,25 @@ inline namespace _v1
             return std::make_unique<scope>(_key{}, this, false, true);
         }
 
-        symbol * get(const std::u32string & name) const;
-        std::optional<symbol *> try_get(const std::u32string & name) const;
+        symbol * get(interned_string name) const;
+        std::optional<symbol *> try_get(interned_string name) const;
 
-        symbol * init(const std::u32string & name, std::unique_ptr<symbol> symb);
+        symbol * init(interned_string name, std::unique_ptr<symbol> symb);
 
         template<typename F>
-        auto get_or_init(const std::u32string & name, F init)
+        auto get_or_init(interned_string name, F init)
         {
             if (auto symb = try_get(name))
             {
                 return symb.value();
             }
 
-            auto init_v = init();
-            auto ret = init_v.get();
-            _symbols_in_order.push_back(init_v.get());
-            _symbols.emplace(name, std::move(init_v));
-            return ret;
+            return _insert(name, init());
         }
 
-        symbol * resolve(const std::u32string & name) const;
+        // walks the parent chain; identifiers from the main preanalysis are bound by `resolve_identifiers`,
+        // the ones created later by late preanalysis call this when they are analyzed
+        symbol * resolve(interned_string name) const;
 
         const auto & declared_symbols() const
         {
@@ -173,15 +173,18 @@ inline namespace _v1
         }
 
     private:
+        symbol * _find(interned_string name) const;
+        symbol * _insert(interned_string name, std::unique_ptr<symbol> symb);
+
         std::u32string _name;
         codegen::ir::scope_type _scope_type;
 
         scope * _parent = nullptr;
         scope * _global = nullptr;
         std::unordered_set<std::unique_ptr<scope>> _keepalive;
-        std::unordered_map<std::u32string, std::unique_ptr<symbol>> _symbols;
+        // sorted by name; scopes are small, and this is only ever searched by preanalysis
+        std::vector<std::pair<interned_string, std::unique_ptr<symbol>>> _symbols;
         std::vector<symbol *> _symbols_in_order;
-        mutable std::unordered_map<std::u32string, symbol *> _resolve_cache;
         const bool _is_local_scope = false;
         const bool _is_shadowing_boundary = false;
         bool _is_closed = false;
@@ -22,7 +22,9 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <shared_mutex>
 
@@ -38,8 +40,7 @@ inline namespace _v1
         using _shlock = std::shared_lock<std::shared_mutex>;
 
     public:
-        symbol(std::u32string name, expression * expression)
-            : _name{ std::move(name) }, _expression{ expression }
+        symbol(interned_string name, expression * expression) : _name{ name }, _expression{ expression }
         {
         }
 
@@ -80,8 +81,24 @@ inline namespace _v1
             }
         }
 
+        // the materializer is called at most once, on the first request for the expression, with `lock` held;
+        // materializers can request other symbols, so all the symbols they can reach must share the lock
+        void set_materializer(std::function<expression *()> materializer, std::recursive_mutex & lock)
+        {
+            assert(!_expression && !_materializer);
+            _materializer = std::move(materializer);
+            _materializer_lock = &lock;
+        }
+
+        bool is_materialized() const
+        {
+            _shlock lock{ _lock };
+            return _expression;
+        }
+
         expression * get_expression() const
         {
+            _materialize();
             _shlock lock{ _lock };
 
             assert(_expression);
@@ -90,19 +107,21 @@ inline namespace _v1
 
         type * get_type() const
         {
+            _materialize();
             _shlock lock{ _lock };
 
             assert(_expression);
             return _expression->get_type();
         }
 
-        std::u32string get_name() const
+        interned_string get_name() const
         {
             return _name;
         }
 
         auto get_expression_future()
         {
+            _materialize();
             _ulock lock{ _lock };
 
             if (_expression && !_future)
@@ -131,6 +150,29 @@ inline namespace _v1
         declaration_ir codegen_ir(ir_generation_context &) const;
 
     private:
+        void _materialize() const
+        {
+            if (!_materializer)
+            {
+                return;
+            }
+
+            if (is_materialized())
+            {
+                return;
+            }
+
+            std::lock_guard<std::recursive_mutex> materializer_lock{ *_materializer_lock };
+            if (is_materialized())
+            {
+                return;
+            }
+
+            auto expr = (*_materializer)();
+            _ulock lock{ _lock };
+            _expression = expr;
+        }
+
         mutable std::shared_mutex _lock;
 
         bool _is_exported = false;
@@ -138,16 +180,19 @@ inline namespace _v1
         bool _is_associated = false;
         std::set<std::u32string> _associated;
 
-        std::u32string _name;
+        interned_string _name;
 
-        expression * _expression;
+        mutable expression * _expression;
         std::optional<future<expression *>> _future;
         std::optional<manual_promise<expression *>> _promise;
+
+        std::optional<std::function<expression *()>> _materializer;
+        std::recursive_mutex * _materializer_lock = nullptr;
     };
 
-    inline auto make_symbol(std::u32string name, expression * expression = nullptr)
+    inline auto make_symbol(interned_string name, expression * expression = nullptr)
     {
-        return std::make_unique<symbol>(std::move(name), expression);
+        return std::make_unique<symbol>(name, expression);
     }
 }
 }
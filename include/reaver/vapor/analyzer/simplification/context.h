@@ -22,8 +22,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <shared_mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <reaver/future.h>
 
@@ -37,6 +40,12 @@ inline namespace _v1
     class expression;
     class function;
 
+    namespace vm
+    {
+        class evaluation_cache;
+        class profile;
+    }
+
     struct call_frame
     {
         class function * function;
@@ -63,11 +72,58 @@ inline namespace _v1
     class cached_results
     {
     public:
+        cached_results();
+        ~cached_results();
+
         void save_call_result(call_frame, std::unique_ptr<expression>);
         std::unique_ptr<expression> get_call_result(call_frame) const;
 
+        // calls the vm failed to evaluate, so that they go straight to simplifying a clone of the body
+        void save_failed_evaluation(call_frame);
+        bool is_failed_evaluation(const call_frame &) const;
+
+        // a collision is a lookup that landed in a bucket holding a different call
+        struct statistics
+        {
+            std::size_t hits;
+            std::size_t misses;
+            std::size_t collisions;
+        };
+
+        statistics get_statistics() const
+        {
+            return { _hits, _misses, _collisions };
+        }
+
+        // consulted before evaluating a call in the vm; outlives the compilation
+        void set_evaluation_cache(vm::evaluation_cache * cache)
+        {
+            _evaluation_cache = cache;
+        }
+
+        vm::evaluation_cache * get_evaluation_cache() const
+        {
+            return _evaluation_cache;
+        }
+
+        // shared by all vm evaluations of the compilation, so that functions stay hot between them; it is
+        // keyed by bytecode addresses, which, like the functions in call frames, outlive these results
+        vm::profile & get_vm_profile() const
+        {
+            return *_vm_profile;
+        }
+
     private:
+        vm::evaluation_cache * _evaluation_cache = nullptr;
+        std::unique_ptr<vm::profile> _vm_profile;
+
+        mutable std::atomic<std::size_t> _hits{ 0 };
+        mutable std::atomic<std::size_t> _misses{ 0 };
+        mutable std::atomic<std::size_t> _collisions{ 0 };
+
+        mutable std::shared_mutex _lock;
         std::unordered_map<call_frame, std::unique_ptr<expression>> _cached_call_results;
+        std::unordered_set<call_frame> _failed_evaluations;
         std::vector<std::unique_ptr<expression>> _key_store;
     };
 
@@ -109,23 +165,20 @@ inline namespace _v1
             return fut;
         }
 
-        void something_happened()
-        {
-            _something_happened = true;
-        }
+        // simplification results stay memoized across passes; a change only drops the results of the changed
+        // node and of everything that used it, transitively, so the next pass only revisits those
+        void record_use(statement * user, statement * used);
+        void something_happened(statement * changed);
 
-        bool did_something_happen() const
-        {
-            return _something_happened;
-        }
+        // returns false once the fixpoint is reached; after the worklist drains, one more full pass confirms
+        // it, since a few results (cached calls, call stacks) depend on state that isn't recorded as a use
+        bool next_pass();
 
         void keep_alive(statement * ptr);
 
         cached_results & results;
 
     private:
-        std::atomic<bool> _something_happened{ false };
-
         using _ulock = std::unique_lock<std::shared_mutex>;
         using _shlock = std::shared_lock<std::shared_mutex>;
 
@@ -133,6 +186,11 @@ inline namespace _v1
         std::unordered_map<statement *, future<statement *>> _statement_futures;
         std::unordered_map<expression *, future<expression *>> _expression_futures;
 
+        std::mutex _worklist_lock;
+        std::unordered_map<statement *, std::unordered_set<statement *>> _users;
+        std::unordered_set<statement *> _dirty;
+        bool _full_pass = true;
+
         std::mutex _keep_alive_lock;
         std::unordered_set<std::unique_ptr<statement>> _keep_alive_stmt;
 
@@ -160,12 +218,50 @@ inline namespace _v1
         return _expression_futures;
     }
 
+    // the calls whose evaluation is in progress; persistent, so pushing a frame shares all the frames
+    // below it with the stack it was pushed onto, and copying a stack is a reference count increment
+    // every stack also carries a persistent hash set of its frames, so that `contains` doesn't depend on the
+    // depth of the stack
+    class call_stack
+    {
+    public:
+        call_stack push(call_frame frame) const;
+        bool contains(const call_frame & frame) const;
+
+        std::size_t depth() const
+        {
+            return _top ? _top->depth : 0;
+        }
+
+    private:
+        // a node of a hash array mapped trie, defined in context.cpp
+        struct _set_node;
+
+        struct _node
+        {
+            call_frame frame;
+            std::size_t depth;
+            std::shared_ptr<const _node> parent;
+            // this frame and all the frames below it
+            std::shared_ptr<const _set_node> frames = nullptr;
+        };
+
+        static std::shared_ptr<const _set_node> _insert(const std::shared_ptr<const _set_node> & node,
+            std::size_t hash,
+            const call_frame * frame,
+            std::size_t shift);
+
+        std::shared_ptr<const _node> _top;
+    };
+
     struct recursive_context
     {
         simplification_context & proper;
 
-        // this desperately needs a functional data structure
-        std::vector<call_frame> call_stack = {};
+        class call_stack call_stack = {};
+
+        // the node whose simplification is running; the nodes it simplifies record it as their user
+        statement * user = nullptr;
     };
 }
 }
@@ -0,0 +1,83 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+#include <boost/filesystem.hpp>
+
+namespace reaver::vapor::analyzer
+{
+inline namespace _v1
+{
+    // hashes of module sources, used to check whether module interface files are up to date
+    // a file is looked at at most once per compilation, and its hash is reused across compilations for as
+    // long as its device, inode, size and modification time stay the same
+    class source_hash_cache
+    {
+    public:
+        // in seconds since the epoch, like the compilation times in module interface files
+        std::int64_t last_write_time(const boost::filesystem::path & path);
+        std::string hash(const boost::filesystem::path & path);
+
+        // a cache that can't be read is treated as empty; entries that are already known are kept
+        void load(std::istream & is);
+        void store(std::ostream & os) const;
+
+    private:
+        struct _file_id
+        {
+            std::uint64_t device;
+            std::uint64_t inode;
+            std::uint64_t size;
+            // in nanoseconds
+            std::int64_t modification_time;
+
+            bool operator==(const _file_id & other) const
+            {
+                return device == other.device && inode == other.inode && size == other.size
+                    && modification_time == other.modification_time;
+            }
+        };
+
+        struct _entry
+        {
+            _file_id id;
+            // empty until computed
+            std::string hash;
+            // whether `id` was checked against the file system during this compilation
+            bool checked;
+        };
+
+        _entry & _check(const boost::filesystem::path & path);
+
+        mutable std::mutex _lock;
+        std::unordered_map<std::string, _entry> _entries;
+    };
+}
+}
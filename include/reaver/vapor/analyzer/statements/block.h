@@ -58,6 +58,11 @@ inline namespace _v1
             std::optional<std::unique_ptr<expression>> value_expr,
             bool is_top_level);
 
+        static bool classof(classof_tag<block>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::block;
+        }
+
         type * value_type() const
         {
             if (_value_expr)
@@ -75,6 +80,11 @@ inline namespace _v1
             return mbind(_statements, [](auto && stmt) { return stmt->get_returns(); });
         }
 
+        const std::vector<std::unique_ptr<statement>> & get_statements() const
+        {
+            return _statements;
+        }
+
         bool has_return_expression() const
         {
             return _value_expr.has_value();
@@ -97,7 +107,9 @@ inline namespace _v1
 
     private:
         block(const block & other)
-            : _original_scope{ other._original_scope }, _is_top_level{ other._is_top_level }
+            : statement{ kind::block },
+              _original_scope{ other._original_scope },
+              _is_top_level{ other._is_top_level }
         {
         }
 
@@ -44,18 +44,23 @@ inline namespace _v1
     {
     public:
         declaration(ast_node parse,
-            std::u32string name,
+            interned_string name,
             std::optional<std::unique_ptr<expression>> init_expr,
             std::optional<std::unique_ptr<expression>> type_specifier,
             scope * scope,
             declaration_type decl_type);
 
+        static bool classof(classof_tag<declaration>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::declaration;
+        }
+
         void mark_exported()
         {
             _declared_symbol->mark_exported();
         }
 
-        const auto & name() const
+        interned_string name() const
         {
             return _name;
         }
@@ -84,7 +89,7 @@ inline namespace _v1
         virtual future<statement *> _simplify(recursive_context ctx) override;
         virtual statement_ir _codegen_ir(ir_generation_context & ctx) const override;
 
-        std::u32string _name;
+        interned_string _name;
         symbol * _declared_symbol;
         std::optional<std::unique_ptr<expression>> _type_specifier;
         std::optional<std::unique_ptr<expression>> _init_expr;
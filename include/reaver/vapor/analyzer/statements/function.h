@@ -43,7 +43,7 @@ inline namespace _v1
     {
     public:
         function_declaration(ast_node parse,
-            std::u32string name,
+            interned_string name,
             parameter_list params,
             std::optional<std::unique_ptr<expression>> return_type,
             std::unique_ptr<scope> scope);
@@ -60,7 +60,7 @@ inline namespace _v1
             return _function.get();
         }
 
-        auto & get_name() const
+        interned_string get_name() const
         {
             return _name;
         }
@@ -80,7 +80,7 @@ inline namespace _v1
     protected:
         std::unique_ptr<scope> _scope;
 
-        std::u32string _name;
+        interned_string _name;
         parameter_list _parameter_list;
         std::optional<std::unique_ptr<expression>> _return_type;
         std::unique_ptr<overload_set_expression_base> _overload_set_expression;
@@ -92,7 +92,7 @@ inline namespace _v1
     {
     public:
         function_definition(ast_node parse,
-            std::u32string name,
+            interned_string name,
             parameter_list params,
             std::optional<std::unique_ptr<expression>> return_type,
             std::unique_ptr<block> body,
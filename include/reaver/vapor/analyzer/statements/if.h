@@ -37,6 +37,11 @@ inline namespace _v1
             std::unique_ptr<statement> then,
             std::optional<std::unique_ptr<statement>> else_);
 
+        static bool classof(classof_tag<if_statement>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::if_statement;
+        }
+
         virtual std::vector<const return_statement *> get_returns() const override
         {
             std::vector<statement *> blocks{ _then_block.get() };
@@ -47,6 +52,21 @@ inline namespace _v1
             return mbind(blocks, [&](auto && block) { return block->get_returns(); });
         }
 
+        expression * get_condition() const
+        {
+            return _condition.get();
+        }
+
+        statement * get_then_block() const
+        {
+            return _then_block.get();
+        }
+
+        statement * get_else_block() const
+        {
+            return _else_block ? _else_block->get() : nullptr;
+        }
+
         virtual void print(std::ostream & os, print_context) const override;
 
     private:
@@ -35,6 +35,11 @@ inline namespace _v1
     public:
         return_statement(ast_node parse, std::unique_ptr<expression> value);
 
+        static bool classof(classof_tag<return_statement>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::return_statement;
+        }
+
         virtual std::vector<const return_statement *> get_returns() const override
         {
             return { this };
@@ -63,7 +68,7 @@ inline namespace _v1
             return _value_expr->analyze(ctx);
         }
 
-        return_statement(const return_statement & other)
+        return_statement(const return_statement & other) : statement{ kind::return_statement }
         {
         }
 
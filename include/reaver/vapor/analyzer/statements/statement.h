@@ -24,6 +24,7 @@
 
 #include <reaver/future.h>
 
+#include "../../casting.h"
 #include "../../print_helpers.h"
 #include "../ir_context.h"
 #include "../semantic/context.h"
@@ -41,9 +42,49 @@ inline namespace _v1
     class statement
     {
     public:
+        // the kind tag behind isa<> and dyn_cast<>
+        // classes that aren't listed here carry the tag of their closest listed base
+        // expressions are kept together at the end, so that `expression::classof` is a single comparison
+        enum class kind
+        {
+            statement,
+            block,
+            declaration,
+            if_statement,
+            null_statement,
+            return_statement,
+
+            expression,
+            boolean_constant,
+            call_expression,
+            owning_call_expression,
+            expression_ref,
+            identifier,
+            function_expression,
+            integer_constant,
+            member_access_expression,
+            member_assignment_expression,
+            member_expression,
+            overload_set_expression,
+            refined_overload_set_expression,
+            pack_expression,
+            owning_pack_expression,
+            parameter,
+            postfix_expression,
+            sized_integer_constant,
+            struct_expression,
+            type_expression,
+            typeclass_expression
+        };
+
         statement() = default;
         virtual ~statement() = default;
 
+        kind get_kind() const
+        {
+            return _kind;
+        }
+
         future<> analyze(analysis_context & ctx)
         {
             if (!_is_future_assigned)
@@ -96,6 +137,8 @@ inline namespace _v1
 
         future<statement *> simplify(recursive_context ctx)
         {
+            ctx.proper.record_use(ctx.user, this);
+            ctx.user = this;
             return ctx.proper.get_future_or_init(
                 this, [&]() { return make_ready_future().then([this, ctx]() { return _simplify(ctx); }); });
         }
@@ -143,6 +186,10 @@ inline namespace _v1
         }
 
     protected:
+        statement(kind k) : _kind{ k }
+        {
+        }
+
         void _set_ast_info(ast_node info)
         {
             assert(!_parse_info);
@@ -175,11 +222,22 @@ inline namespace _v1
         mutable std::optional<statement_ir> _ir;
 
         std::optional<ast_node> _parse_info;
+
+        const kind _kind = kind::statement;
     };
 
     class null_statement : public statement
     {
     public:
+        null_statement() : statement{ kind::null_statement }
+        {
+        }
+
+        static bool classof(classof_tag<null_statement>, const statement * stmt)
+        {
+            return stmt->get_kind() == kind::null_statement;
+        }
+
         virtual void print(std::ostream &, print_context) const override
         {
         }
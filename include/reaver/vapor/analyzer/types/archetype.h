@@ -35,6 +35,11 @@ inline namespace _v1
     public:
         archetype(ast_node node, const type * base, std::u32string param_name);
 
+        static bool classof(classof_tag<archetype>, const type * t)
+        {
+            return t->get_kind() == kind::archetype;
+        }
+
         auto get_ast_info() const
         {
             return std::make_optional(_node);
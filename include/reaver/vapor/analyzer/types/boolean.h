@@ -94,7 +94,8 @@ inline namespace _v1
         static auto _generate_function(const char32_t * name,
             const char * desc,
             Eval eval,
-            type * return_type);
+            type * return_type,
+            vm::intrinsic intrinsic);
         static function * _equal_comparison();
     };
 
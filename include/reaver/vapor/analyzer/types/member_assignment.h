@@ -32,17 +32,17 @@ inline namespace _v1
     class member_assignment_expression;
     class member_assignment_type;
 
-    std::unique_ptr<member_assignment_type> make_member_assignment_type(std::u32string member_name,
+    std::unique_ptr<member_assignment_type> make_member_assignment_type(interned_string member_name,
         member_assignment_expression * var,
         bool = false);
 
     class member_assignment_type : public type
     {
     public:
-        member_assignment_type(std::u32string member_name,
+        member_assignment_type(interned_string member_name,
             member_assignment_expression * expr,
             bool is_assigned = false)
-            : _member_name{ std::move(member_name) }, _expr{ expr }, _assigned{ is_assigned }
+            : _member_name{ member_name }, _expr{ expr }, _assigned{ is_assigned }
         {
             if (!_assigned)
             {
@@ -54,17 +54,17 @@ inline namespace _v1
 
         virtual std::string explain() const override
         {
-            return "member assignment type for member " + utf8(_member_name);
+            return "member assignment type for member " + _member_name.utf8();
         }
 
         virtual void print(std::ostream & os, print_context ctx) const override
         {
             os << styles::def << ctx << styles::type << "member assignment type";
             os << styles::def << " @ " << styles::address << this;
-            os << styles::def << ": " << styles::string_value << utf8(_member_name) << '\n';
+            os << styles::def << ": " << styles::string_value << _member_name.utf8() << '\n';
         }
 
-        const std::u32string & member_name() const
+        interned_string member_name() const
         {
             return _member_name;
         }
@@ -98,7 +98,7 @@ inline namespace _v1
             assert(0);
         }
 
-        std::u32string _member_name;
+        interned_string _member_name;
         member_assignment_expression * _expr;
 
         bool _assigned = false;
@@ -109,11 +109,11 @@ inline namespace _v1
         mutable std::vector<std::unique_ptr<expression>> _expr_storage;
     };
 
-    inline std::unique_ptr<member_assignment_type> make_member_assignment_type(std::u32string member_name,
+    inline std::unique_ptr<member_assignment_type> make_member_assignment_type(interned_string member_name,
         member_assignment_expression * var,
         bool is_assigned)
     {
-        return std::make_unique<member_assignment_type>(std::move(member_name), var, is_assigned);
+        return std::make_unique<member_assignment_type>(member_name, var, is_assigned);
     }
 }
 }
@@ -37,10 +37,15 @@ inline namespace _v1
     {
     public:
         module_type(std::unique_ptr<scope> lex_scope, std::string name)
-            : type{ std::move(lex_scope) }, _name{ std::move(name) }
+            : type{ kind::module_type, std::move(lex_scope) }, _name{ std::move(name) }
         {
         }
 
+        static bool classof(classof_tag<module_type>, const type * t)
+        {
+            return t->get_kind() == kind::module_type;
+        }
+
         virtual std::string explain() const override
         {
             return "module type for module `" + _name + "`";
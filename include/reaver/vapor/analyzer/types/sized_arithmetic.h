@@ -0,0 +1,170 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include "../../interned_integer.h"
+
+namespace reaver::vapor::analyzer
+{
+inline namespace _v1
+{
+    // arithmetic on sized integers wraps around exactly like the two's complement iN they are emitted as
+    // widths up to 128 bits are computed in machine integers; wider ones fall back to cpp_int
+    namespace sized_arithmetic
+    {
+        enum class operation
+        {
+            addition,
+            subtraction,
+            multiplication,
+            division
+        };
+
+        // the vm unboxes sized integers into a single word
+        constexpr std::size_t max_word_width = 64;
+        // sized integer constants up to this width are stored and folded as int128
+        constexpr std::size_t max_fast_width = 128;
+
+        inline std::int64_t wrap(std::uint64_t value, std::size_t width)
+        {
+            assert(width > 0 && width <= max_word_width);
+
+            if (width < 64)
+            {
+                auto sign = std::uint64_t(1) << (width - 1);
+                value = ((value & ((sign << 1) - 1)) ^ sign) - sign;
+            }
+
+            return static_cast<std::int64_t>(value);
+        }
+
+        inline int128 wrap(uint128 value, std::size_t width)
+        {
+            assert(width > 0 && width <= max_fast_width);
+
+            if (width < 128)
+            {
+                auto sign = uint128(1) << (width - 1);
+                value = ((value & ((sign << 1) - 1)) ^ sign) - sign;
+            }
+
+            return static_cast<int128>(value);
+        }
+
+        inline boost::multiprecision::cpp_int wrap(const boost::multiprecision::cpp_int & value,
+            std::size_t width)
+        {
+            boost::multiprecision::cpp_int modulus = boost::multiprecision::cpp_int(1) << width;
+
+            boost::multiprecision::cpp_int ret = value % modulus;
+            if (ret < 0)
+            {
+                ret += modulus;
+            }
+            if (ret >= modulus >> 1)
+            {
+                ret -= modulus;
+            }
+
+            return ret;
+        }
+
+        // division by zero has no result; Int is std::int64_t or int128, for widths that fit in it
+        template<typename Int>
+        std::optional<Int> apply(operation op, Int lhs, Int rhs, std::size_t width)
+        {
+            // unsigned arithmetic wraps instead of overflowing
+            using unsigned_type = std::conditional_t<std::is_same_v<Int, int128>, uint128, std::uint64_t>;
+            auto ulhs = static_cast<unsigned_type>(lhs);
+            auto urhs = static_cast<unsigned_type>(rhs);
+
+            switch (op)
+            {
+                case operation::addition:
+                    return wrap(ulhs + urhs, width);
+                case operation::subtraction:
+                    return wrap(ulhs - urhs, width);
+                case operation::multiplication:
+                    return wrap(ulhs * urhs, width);
+                case operation::division:
+                    if (rhs == 0)
+                    {
+                        return std::nullopt;
+                    }
+                    // the one quotient that doesn't fit: the minimum divided by -1 wraps back to the minimum
+                    if (rhs == -1)
+                    {
+                        return wrap(0 - ulhs, width);
+                    }
+                    return wrap(static_cast<unsigned_type>(lhs / rhs), width);
+            }
+
+            assert(0);
+            return std::nullopt;
+        }
+
+        inline std::optional<boost::multiprecision::cpp_int> apply(operation op,
+            const boost::multiprecision::cpp_int & lhs,
+            const boost::multiprecision::cpp_int & rhs,
+            std::size_t width)
+        {
+            if (width <= max_fast_width)
+            {
+                auto result = apply(op, to_int128(lhs).value(), to_int128(rhs).value(), width);
+                if (!result)
+                {
+                    return std::nullopt;
+                }
+                return to_cpp_int(result.value());
+            }
+
+            switch (op)
+            {
+                case operation::addition:
+                    return wrap(lhs + rhs, width);
+                case operation::subtraction:
+                    return wrap(lhs - rhs, width);
+                case operation::multiplication:
+                    return wrap(lhs * rhs, width);
+                case operation::division:
+                    if (rhs == 0)
+                    {
+                        return std::nullopt;
+                    }
+                    // cpp_int division truncates towards zero, like sdiv
+                    return wrap(lhs / rhs, width);
+            }
+
+            assert(0);
+            return std::nullopt;
+        }
+    }
+}
+}
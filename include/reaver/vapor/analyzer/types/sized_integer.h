@@ -34,6 +34,11 @@ inline namespace _v1
     public:
         sized_integer(std::size_t size);
 
+        static bool classof(classof_tag<sized_integer>, const type * t)
+        {
+            return t->get_kind() == kind::sized_integer;
+        }
+
         virtual std::string explain() const override
         {
             return "sized_integer(" + std::to_string(_size) + ")";
@@ -79,7 +84,7 @@ inline namespace _v1
 
         virtual bool matches(type * other) const override
         {
-            if (auto other_sized = dynamic_cast<sized_integer *>(other))
+            if (auto other_sized = dyn_cast<sized_integer>(other))
             {
                 return _size <= other_sized->_size;
             }
@@ -124,7 +129,11 @@ inline namespace _v1
         boost::multiprecision::cpp_int _min_value;
 
         template<typename Instruction, typename Eval>
-        auto _generate_function(std::u32string name, std::string desc, Eval eval, type * return_type);
+        auto _generate_function(std::u32string name,
+            std::string desc,
+            Eval eval,
+            type * return_type,
+            vm::intrinsic intrinsic);
         std::unique_ptr<function> _addition;
         std::unique_ptr<function> _subtraction;
         std::unique_ptr<function> _multiplication;
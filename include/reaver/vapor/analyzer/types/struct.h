@@ -42,6 +42,11 @@ inline namespace _v1
 
         ~struct_type();
 
+        static bool classof(classof_tag<struct_type>, const type * t)
+        {
+            return t->get_kind() == kind::struct_type;
+        }
+
         void generate_constructors();
 
         virtual std::string explain() const override
@@ -82,7 +87,7 @@ inline namespace _v1
             return std::make_optional(_parse);
         }
 
-        virtual type * get_member_type(const std::u32string & name) const override
+        virtual type * get_member_type(interned_string name) const override
         {
             auto it = std::find_if(_data_members.begin(), _data_members.end(), [&](auto && member) {
                 return member->get_name() == name;
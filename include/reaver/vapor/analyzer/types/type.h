@@ -29,6 +29,7 @@
 
 #include <google/protobuf/message.h>
 
+#include "../../casting.h"
 #include "../../codegen/ir/type.h"
 #include "../../lexer/token.h"
 #include "../../print_helpers.h"
@@ -63,10 +64,19 @@ inline namespace _v1
     class type
     {
     public:
-        type() : _member_scope{ std::make_unique<scope>() }
+        // the kind tag behind isa<> and dyn_cast<>, see `statement::kind`
+        enum class kind
+        {
+            type,
+            archetype,
+            module_type,
+            sized_integer,
+            struct_type,
+            typeclass_instance_type
+        };
+
+        type() : type{ kind::type }
         {
-            _init_expr();
-            _init_pack_type();
         }
 
         type(scope * outer_scope) : _member_scope{ outer_scope->clone_for_class() }
@@ -75,10 +85,8 @@ inline namespace _v1
             _init_pack_type();
         }
 
-        type(std::unique_ptr<scope> member_scope) : _member_scope{ std::move(member_scope) }
+        type(std::unique_ptr<scope> member_scope) : type{ kind::type, std::move(member_scope) }
         {
-            _init_expr();
-            _init_pack_type();
         }
 
         static constexpr struct dont_init_expr_t
@@ -103,7 +111,19 @@ inline namespace _v1
             }
         }
 
+        kind get_kind() const
+        {
+            return _kind;
+        }
+
     protected:
+        type(kind k, std::unique_ptr<scope> member_scope = std::make_unique<scope>())
+            : _member_scope{ std::move(member_scope) }, _kind{ k }
+        {
+            _init_expr();
+            _init_pack_type();
+        }
+
         // this is virtually only for `pack_type`
         // don't abuse, please
         static constexpr struct dont_init_pack_t
@@ -141,7 +161,7 @@ inline namespace _v1
             return _member_scope.get();
         }
 
-        virtual type * get_member_type(const std::u32string &) const
+        virtual type * get_member_type(interned_string) const
         {
             return nullptr;
         }
@@ -228,6 +248,9 @@ inline namespace _v1
         mutable std::optional<std::shared_ptr<codegen::ir::type>> _codegen_t;
 
         std::u32string _name;
+
+    private:
+        const kind _kind = kind::type;
     };
 
     class user_defined_type : public type
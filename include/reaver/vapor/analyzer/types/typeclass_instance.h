@@ -41,6 +41,11 @@ inline namespace _v1
 
         typeclass_instance_type(typeclass * tc, std::vector<expression *> arguments);
 
+        static bool classof(classof_tag<typeclass_instance_type>, const type * t)
+        {
+            return t->get_kind() == kind::typeclass_instance_type;
+        }
+
         virtual std::string explain() const override;
         virtual void print(std::ostream & os, print_context ctx) const override;
 
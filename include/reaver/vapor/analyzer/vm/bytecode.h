@@ -0,0 +1,108 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "value.h"
+
+namespace reaver::vapor::analyzer
+{
+inline namespace _v1
+{
+    namespace vm
+    {
+        // registers are numbered per frame; the first parameter_count registers hold the arguments
+        enum class opcode : std::uint8_t
+        {
+            constant, // dst = constants[a]
+            copy,     // dst = a
+
+            // dst = a op b, wrapped around to a sized integer of width c; division by zero fails
+            sized_addition,
+            sized_subtraction,
+            sized_multiplication,
+            sized_division,
+            sized_equal_comparison,
+            sized_less_comparison,
+            sized_less_equal_comparison,
+
+            // dst = a op b
+            integer_addition,
+            integer_subtraction,
+            integer_multiplication,
+            integer_equal_comparison,
+            integer_less_comparison,
+            integer_less_equal_comparison,
+            boolean_equal_comparison,
+
+            make_aggregate, // dst = { a, ..., a + b - 1 }
+            extract,        // dst = member b of a
+
+            jump,        // continue at a
+            jump_unless, // continue at b if a is false
+            call,        // dst = callees[a](b, ..., b + c - 1)
+            ret          // return a
+        };
+
+        struct instruction
+        {
+            opcode op;
+            std::uint32_t dst = 0;
+            std::uint32_t a = 0;
+            std::uint32_t b = 0;
+            std::uint32_t c = 0;
+        };
+
+        struct bytecode_function
+        {
+            std::uint32_t parameter_count = 0;
+            std::uint32_t register_count = 0;
+            std::vector<instruction> code;
+            std::vector<value> constants;
+            std::vector<const bytecode_function *> callees;
+
+            // false while the function is being lowered, and forever if the lowering failed; a recursive
+            // call can refer to a function before it is complete, so the interpreter checks this on calls
+            bool valid = false;
+            // set only while `lower` works on the function
+            bool in_progress = false;
+
+            // identifies the function and everything it calls in the evaluation cache; computed on first use
+            mutable std::string digest = {};
+        };
+
+        // how a call to a builtin function lowers: the operand is the width for sized integer operations
+        // and the member count for aggregates; a replacing aggregate takes an aggregate as its first
+        // argument, and fills in the members left at their default value from it
+        struct intrinsic
+        {
+            opcode op;
+            std::uint32_t operand = 0;
+            bool replacing = false;
+        };
+    }
+}
+}
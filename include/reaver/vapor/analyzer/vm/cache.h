@@ -0,0 +1,86 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <istream>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "bytecode.h"
+
+namespace reaver::vapor::analyzer
+{
+inline namespace _v1
+{
+    namespace vm
+    {
+        // results of compile-time evaluations, kept across compilations next to the module interface file
+        // functions are identified by a digest of their bytecode and of everything it calls, so an entry can
+        // never be used for a function that has changed since it was saved
+        class evaluation_cache
+        {
+        public:
+            std::optional<value> get(const bytecode_function & function,
+                const std::vector<value> & arguments);
+            void save(const bytecode_function & function, std::vector<value> arguments, value result);
+
+            // a cache that can't be read is treated as empty
+            void load(std::istream & is);
+            // only the entries used or added since loading are written back, so stale ones get dropped
+            void store(std::ostream & os) const;
+
+        private:
+            struct _key
+            {
+                std::string function_digest;
+                std::vector<value> arguments;
+            };
+
+            struct _key_hash
+            {
+                std::size_t operator()(const _key & key) const;
+            };
+
+            struct _key_equal
+            {
+                bool operator()(const _key & lhs, const _key & rhs) const;
+            };
+
+            struct _entry
+            {
+                value result;
+                bool used;
+            };
+
+            const std::string & _digest(const bytecode_function & function);
+
+            mutable std::mutex _lock;
+            std::unordered_map<_key, _entry, _key_hash, _key_equal> _results;
+        };
+    }
+}
+}
@@ -0,0 +1,83 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "bytecode.h"
+
+namespace reaver::vapor::analyzer
+{
+inline namespace _v1
+{
+    namespace vm
+    {
+        // compile-time evaluation has to terminate even when the evaluated code doesn't
+        struct limits
+        {
+            std::size_t steps = 1 << 24;
+            std::size_t depth = 1 << 12;
+            // a function gets hot, and its results are memoized by arguments, after this many calls or after
+            // a single call that takes more than this many steps
+            std::size_t hot_calls = 64;
+            std::size_t hot_steps = 1 << 16;
+        };
+
+        // what the vm has learned about the functions it ran; meant to live for the whole compilation, so
+        // that a function that got hot in one evaluation stays hot, and keeps its results, in the next ones
+        class profile
+        {
+        public:
+            profile();
+            ~profile();
+
+            // counts a call; returns whether the function is hot
+            bool enter(const bytecode_function *, const limits &);
+            void mark_hot(const bytecode_function *);
+            bool is_hot(const bytecode_function *) const;
+
+            std::optional<value> find_result(const bytecode_function *, const std::vector<value> &) const;
+            void save_result(const bytecode_function *, std::vector<value>, value);
+
+        private:
+            struct _function_profile;
+
+            mutable std::mutex _lock;
+            std::unordered_map<const bytecode_function *, std::unique_ptr<_function_profile>> _functions;
+        };
+
+        // returns an empty optional when the evaluation fails: on division by zero, a call to a function that
+        // couldn't be lowered, or when it runs out of steps or stack; sized arithmetic wraps around
+        // without a profile, functions only get hot within this one evaluation
+        std::optional<value> run(const bytecode_function & function,
+            std::vector<value> arguments,
+            limits budget = {},
+            profile * shared_profile = nullptr);
+    }
+}
+}
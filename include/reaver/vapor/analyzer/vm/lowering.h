@@ -0,0 +1,48 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "bytecode.h"
+
+namespace reaver::vapor::analyzer
+{
+inline namespace _v1
+{
+    class expression;
+    class function;
+    class type;
+
+    namespace vm
+    {
+        // lowers the body of a function to bytecode, once per function; returns nullptr when the body uses
+        // something the vm can't evaluate, and the caller has to simplify a clone of the body instead
+        const bytecode_function * lower(function * fn);
+
+        std::optional<value> to_value(const expression * expr);
+        std::unique_ptr<expression> to_expression(const value & val, type * value_type);
+    }
+}
+}
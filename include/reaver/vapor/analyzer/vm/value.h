@@ -0,0 +1,147 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <variant>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+
+namespace reaver::vapor::analyzer
+{
+inline namespace _v1
+{
+    namespace vm
+    {
+        class value;
+
+        // aggregates are immutable once built, so copying a value never copies its members
+        using aggregate = std::shared_ptr<const std::vector<value>>;
+
+        // sized integers are kept unboxed; the lowering only accepts widths that fit in 64 bits
+        class value
+        {
+        public:
+            value() = default;
+
+            value(std::int64_t sized) : _storage{ sized }
+            {
+            }
+
+            value(bool boolean) : _storage{ boolean }
+            {
+            }
+
+            value(boost::multiprecision::cpp_int integer) : _storage{ std::move(integer) }
+            {
+            }
+
+            value(aggregate members) : _storage{ std::move(members) }
+            {
+            }
+
+            bool is_set() const
+            {
+                return _storage.index() != 0;
+            }
+
+            const std::int64_t * as_sized() const
+            {
+                return std::get_if<std::int64_t>(&_storage);
+            }
+
+            const bool * as_boolean() const
+            {
+                return std::get_if<bool>(&_storage);
+            }
+
+            const boost::multiprecision::cpp_int * as_integer() const
+            {
+                return std::get_if<boost::multiprecision::cpp_int>(&_storage);
+            }
+
+            const aggregate * as_aggregate() const
+            {
+                return std::get_if<aggregate>(&_storage);
+            }
+
+            // aggregates compare and hash by their members
+            friend bool operator==(const value & lhs, const value & rhs)
+            {
+                auto lhs_members = lhs.as_aggregate();
+                auto rhs_members = rhs.as_aggregate();
+                if (lhs_members && rhs_members)
+                {
+                    return **lhs_members == **rhs_members;
+                }
+
+                return lhs._storage == rhs._storage;
+            }
+
+            friend bool operator!=(const value & lhs, const value & rhs)
+            {
+                return !(lhs == rhs);
+            }
+
+            std::size_t hash() const
+            {
+                std::size_t seed = _storage.index();
+
+                if (auto sized = as_sized())
+                {
+                    boost::hash_combine(seed, *sized);
+                }
+                else if (auto boolean = as_boolean())
+                {
+                    boost::hash_combine(seed, *boolean);
+                }
+                else if (auto integer = as_integer())
+                {
+                    // the low bits and the sign are enough to spread the values used in practice
+                    auto low = *integer & std::numeric_limits<std::size_t>::max();
+                    boost::hash_combine(seed, static_cast<std::size_t>(low));
+                    boost::hash_combine(seed, integer->sign());
+                }
+                else if (auto members = as_aggregate())
+                {
+                    for (auto && member : **members)
+                    {
+                        boost::hash_combine(seed, member.hash());
+                    }
+                }
+
+                return seed;
+            }
+
+        private:
+            using _storage_type =
+                std::variant<std::monostate, std::int64_t, bool, boost::multiprecision::cpp_int, aggregate>;
+            _storage_type _storage;
+        };
+    }
+}
+}
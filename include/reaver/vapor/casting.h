@@ -0,0 +1,111 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <cassert>
+#include <memory>
+#include <type_traits>
+
+namespace reaver::vapor
+{
+inline namespace _v1
+{
+    // checked downcasts for the class hierarchies that carry a kind tag
+    // a class opts in by providing `static bool classof(classof_tag<itself>, const base *)`, which checks
+    // the kind stored in the base; the tag keeps the classes that don't opt in from inheriting the classof
+    // of their base, and those fall back to dynamic_cast
+    template<typename T>
+    struct classof_tag
+    {
+    };
+
+    namespace _detail
+    {
+        template<typename T, typename U, typename = void>
+        struct has_classof : std::false_type
+        {
+        };
+
+        template<typename T, typename U>
+        struct has_classof<T,
+            U,
+            std::void_t<decltype(T::classof(classof_tag<T>{}, std::declval<const U *>()))>> : std::true_type
+        {
+        };
+
+        template<typename T, typename U>
+        using cast_result = std::conditional_t<std::is_const_v<U>, const T *, T *>;
+    }
+
+    template<typename T, typename U>
+    bool isa(const U * ptr)
+    {
+        assert(ptr);
+
+        if constexpr (std::is_base_of_v<T, U>)
+        {
+            return true;
+        }
+
+        else if constexpr (_detail::has_classof<T, U>::value)
+        {
+            return T::classof(classof_tag<T>{}, ptr);
+        }
+
+        else
+        {
+            return dynamic_cast<const T *>(ptr);
+        }
+    }
+
+    template<typename T, typename U>
+    _detail::cast_result<T, U> cast(U * ptr)
+    {
+        assert(isa<T>(ptr));
+        return static_cast<_detail::cast_result<T, U>>(ptr);
+    }
+
+    // unlike LLVM's, this one accepts null, to be a drop-in replacement for dynamic_cast
+    template<typename T, typename U>
+    _detail::cast_result<T, U> dyn_cast(U * ptr)
+    {
+        if (!ptr || !isa<T>(ptr))
+        {
+            return nullptr;
+        }
+
+        return static_cast<_detail::cast_result<T, U>>(ptr);
+    }
+
+    template<typename T, typename U>
+    std::shared_ptr<T> dyn_pointer_cast(const std::shared_ptr<U> & ptr)
+    {
+        if (auto raw = dyn_cast<T>(ptr.get()))
+        {
+            return std::shared_ptr<T>{ ptr, raw };
+        }
+
+        return nullptr;
+    }
+}
+}
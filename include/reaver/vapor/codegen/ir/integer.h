@@ -24,7 +24,7 @@
 
 #include <optional>
 
-#include <boost/multiprecision/cpp_int.hpp>
+#include "../../interned_integer.h"
 
 namespace reaver::vapor::codegen
 {
@@ -32,9 +32,10 @@ inline namespace _v1
 {
     namespace ir
     {
+        // values up to 128 bits, including every sized integer up to i128, are stored inline
         struct integer_value
         {
-            boost::multiprecision::cpp_int value;
+            interned_integer value;
             std::optional<std::size_t> size = std::nullopt;
         };
 
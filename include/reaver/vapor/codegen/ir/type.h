@@ -28,6 +28,7 @@
 
 #include <reaver/variant.h>
 
+#include "../../casting.h"
 #include "function.h"
 #include "scope.h"
 
@@ -51,14 +52,35 @@ inline namespace _v1
 
         struct type
         {
+            // the kind tag behind isa<> and dyn_cast<>
+            enum class kind
+            {
+                type,
+                user_type,
+                sized_integer_type,
+                function_type
+            };
+
+            explicit type(kind k = kind::type) : _kind{ k }
+            {
+            }
+
             virtual ~type() = default;
 
+            kind get_kind() const
+            {
+                return _kind;
+            }
+
             virtual bool is_fundamental() const
             {
                 return true;
             }
 
             void operator=(const user_type &) = delete;
+
+        private:
+            kind _kind;
         };
 
         struct user_type : type
@@ -67,13 +89,19 @@ inline namespace _v1
                 std::vector<scope> scopes = {},
                 std::size_t size = {},
                 std::vector<member> members = {})
-                : name{ std::move(name) },
+                : type{ kind::user_type },
+                  name{ std::move(name) },
                   scopes{ std::move(scopes) },
                   size{ size },
                   members{ std::move(members) }
             {
             }
 
+            static bool classof(classof_tag<user_type>, const type * t)
+            {
+                return t->get_kind() == kind::user_type;
+            }
+
             virtual bool is_fundamental() const
             {
                 return false;
@@ -89,11 +117,29 @@ inline namespace _v1
 
         struct sized_integer_type : type
         {
+            sized_integer_type() : type{ kind::sized_integer_type }
+            {
+            }
+
+            static bool classof(classof_tag<sized_integer_type>, const type * t)
+            {
+                return t->get_kind() == kind::sized_integer_type;
+            }
+
             std::size_t integer_size;
         };
 
         struct function_type : type
         {
+            function_type() : type{ kind::function_type }
+            {
+            }
+
+            static bool classof(classof_tag<function_type>, const type * t)
+            {
+                return t->get_kind() == kind::function_type;
+            }
+
             std::shared_ptr<type> return_type;
             std::vector<std::shared_ptr<type>> parameter_types;
         };
@@ -28,6 +28,7 @@
 
 #include <reaver/variant.h>
 
+#include "../../interned_string.h"
 #include "../../utf.h"
 #include "scope.h"
 
@@ -42,13 +43,13 @@ inline namespace _v1
 
         struct variable
         {
-            variable(std::shared_ptr<struct type> type, std::optional<std::u32string> name)
-                : type{ std::move(type) }, name{ std::move(name) }
+            variable(std::shared_ptr<struct type> type, std::optional<interned_string> name)
+                : type{ std::move(type) }, name{ name }
             {
             }
 
             std::shared_ptr<struct type> type;
-            std::optional<std::u32string> name;
+            std::optional<interned_string> name;
             bool declared = false;
             bool destroyed = false;
             bool parameter = false;
@@ -65,9 +66,9 @@ inline namespace _v1
         };
 
         inline std::shared_ptr<variable> make_variable(std::shared_ptr<struct type> type,
-            std::optional<std::u32string> name = std::nullopt)
+            std::optional<interned_string> name = std::nullopt)
         {
-            return std::make_shared<variable>(variable{ std::move(type), std::move(name) });
+            return std::make_shared<variable>(variable{ std::move(type), name });
         }
     }
 }
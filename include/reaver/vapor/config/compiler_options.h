@@ -76,6 +76,17 @@ inline namespace _v1
             _mode = mode;
         }
 
+        std::size_t jobs() const
+        {
+            return _jobs;
+        }
+
+        void set_jobs(std::size_t jobs)
+        {
+            assert(jobs != 0);
+            _jobs = jobs;
+        }
+
         void set_compilation_handler(compilation_handler handler)
         {
             _compilation_handler = std::move(handler);
@@ -108,6 +119,10 @@ public:
 #undef DEFINE_DIR
 
         boost::filesystem::path object_path() const;
+        // compile-time evaluation results, kept next to the module interface file
+        boost::filesystem::path evaluation_cache_path() const;
+        // hashes of module sources, shared by everything compiled into the same module directory
+        boost::filesystem::path source_hash_cache_path() const;
         void set_output_dir(boost::filesystem::path dir);
 
         const std::vector<boost::filesystem::path> & module_paths() const
@@ -128,6 +143,7 @@ public:
         std::optional<compilation_handler> _compilation_handler;
 
         modes_enum _mode = compilation_modes::link;
+        std::size_t _jobs = 1;
         std::optional<boost::filesystem::path> _source_path;
         std::optional<boost::filesystem::path> _output_dir;
         std::vector<boost::filesystem::path> _module_paths;
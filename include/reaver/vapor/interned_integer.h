@@ -0,0 +1,143 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+namespace reaver::vapor
+{
+inline namespace _v1
+{
+    __extension__ typedef __int128 int128;
+    __extension__ typedef unsigned __int128 uint128;
+
+    boost::multiprecision::cpp_int to_cpp_int(int128 value);
+    std::optional<int128> to_int128(const boost::multiprecision::cpp_int & value);
+
+    // an arbitrary precision integer that is cheap to create, copy, compare and hash
+    // values that fit in 128 bits, which covers sized integers up to i128 and nearly every unsized constant,
+    // are stored inline; wider values are stored once in a process-wide table, so that comparing and hashing
+    // them is comparing and hashing pointers, and copying them never copies the digits; table entries are
+    // reference counted and freed together with the last handle to them
+    class interned_integer
+    {
+    public:
+        explicit interned_integer(int128 value = 0) : _small{ value }
+        {
+        }
+
+        interned_integer(const boost::multiprecision::cpp_int & value);
+
+        interned_integer(const interned_integer & other) : _small{ other._small }, _entry{ other._entry }
+        {
+            if (_entry)
+            {
+                _entry->second.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        // leaves zero behind
+        interned_integer(interned_integer && other) noexcept
+            : _small{ std::exchange(other._small, 0) }, _entry{ std::exchange(other._entry, nullptr) }
+        {
+        }
+
+        interned_integer & operator=(interned_integer other) noexcept
+        {
+            std::swap(_small, other._small);
+            std::swap(_entry, other._entry);
+            return *this;
+        }
+
+        ~interned_integer();
+
+        boost::multiprecision::cpp_int get() const
+        {
+            return _entry ? _entry->first : to_cpp_int(_small);
+        }
+
+        bool is_small() const
+        {
+            return !_entry;
+        }
+
+        int128 small_value() const
+        {
+            assert(is_small());
+            return _small;
+        }
+
+        std::size_t hash() const
+        {
+            if (_entry)
+            {
+                return std::hash<const void *>()(_entry);
+            }
+
+            auto value = static_cast<uint128>(_small);
+            return std::hash<std::uint64_t>()(static_cast<std::uint64_t>(value))
+                ^ std::hash<std::uint64_t>()(static_cast<std::uint64_t>(value >> 64)) * 31;
+        }
+
+        // a value is stored inline exactly when it fits, so equal values are always stored the same way
+        friend bool operator==(const interned_integer & lhs, const interned_integer & rhs)
+        {
+            return lhs._entry == rhs._entry && lhs._small == rhs._small;
+        }
+
+        friend bool operator!=(const interned_integer & lhs, const interned_integer & rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        // the number of distinct wide values currently held by the table
+        static std::size_t table_size();
+
+    private:
+        using _entry_type = std::pair<const boost::multiprecision::cpp_int, std::atomic<std::size_t>>;
+
+        int128 _small;
+        _entry_type * _entry = nullptr;
+    };
+}
+}
+
+namespace std
+{
+template<>
+struct hash<::reaver::vapor::interned_integer>
+{
+    std::size_t operator()(const ::reaver::vapor::interned_integer & value) const
+    {
+        return value.hash();
+    }
+};
+}
@@ -0,0 +1,131 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace reaver::vapor
+{
+inline namespace _v1
+{
+    // a handle to an identifier stored once in a process-wide table
+    // equal strings always share the same entry, so comparing and hashing handles is comparing and hashing
+    // pointers; the text is only hashed when a handle is created
+    // entries are never freed, which makes the handles trivially copyable and valid for the whole run
+    class interned_string
+    {
+    public:
+        struct entry
+        {
+            std::string utf8;
+            std::u32string utf32;
+        };
+
+        interned_string() = default;
+
+        interned_string(std::u32string_view str);
+
+        interned_string(const std::u32string & str) : interned_string{ std::u32string_view{ str } }
+        {
+        }
+
+        interned_string(const char32_t * str) : interned_string{ std::u32string_view{ str } }
+        {
+        }
+
+        static interned_string from_utf8(std::string_view str);
+
+        const std::u32string & str() const
+        {
+            return _entry ? _entry->utf32 : _empty().utf32;
+        }
+
+        operator const std::u32string &() const
+        {
+            return str();
+        }
+
+        const std::string & utf8() const
+        {
+            return _entry ? _entry->utf8 : _empty().utf8;
+        }
+
+        bool empty() const
+        {
+            return str().empty();
+        }
+
+        const void * id() const
+        {
+            return _entry;
+        }
+
+    private:
+        interned_string(const entry * e) : _entry{ e }
+        {
+        }
+
+        static const entry & _empty();
+
+        // nullptr stands for the empty string
+        const entry * _entry = nullptr;
+    };
+
+    inline bool operator==(const interned_string & lhs, const interned_string & rhs)
+    {
+        return lhs.id() == rhs.id();
+    }
+
+    inline bool operator!=(const interned_string & lhs, const interned_string & rhs)
+    {
+        return lhs.id() != rhs.id();
+    }
+
+    // this is *not* an alphabetical order, but a stable one within a single run
+    // use .str() for anything that needs to be deterministic across runs
+    inline bool operator<(const interned_string & lhs, const interned_string & rhs)
+    {
+        return std::less<const void *>()(lhs.id(), rhs.id());
+    }
+
+    inline std::ostream & operator<<(std::ostream & os, const interned_string & str)
+    {
+        return os << str.utf8();
+    }
+}
+}
+
+namespace std
+{
+template<>
+struct hash<::reaver::vapor::interned_string>
+{
+    std::size_t operator()(const ::reaver::vapor::interned_string & str) const
+    {
+        return std::hash<const void *>()(str.id());
+    }
+};
+}
@@ -23,3 +23,4 @@
 #pragma once
 
 #include "lexer/iterator.h"
+#include "lexer/token_buffer.h"
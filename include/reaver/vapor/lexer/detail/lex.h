@@ -0,0 +1,285 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include <reaver/exception.h>
+
+#include "../../position.h"
+#include "../../source_manager.h"
+#include "../errors.h"
+#include "../token.h"
+#include "recognizer.h"
+#include "scan.h"
+
+namespace reaver::vapor::lexer
+{
+inline namespace _v1
+{
+    namespace _detail
+    {
+        // decodes a single code point of a UTF-8 sequence
+        // returns the length of the sequence in bytes through `length`, which is set to 0 on malformed input
+        inline char32_t _decode_utf8(const char * it, const char * end, std::size_t & length)
+        {
+            auto lead = static_cast<unsigned char>(*it);
+
+            if (lead < 0x80)
+            {
+                length = 1;
+                return lead;
+            }
+
+            char32_t ret;
+            if ((lead & 0xe0) == 0xc0)
+            {
+                length = 2;
+                ret = lead & 0x1f;
+            }
+            else if ((lead & 0xf0) == 0xe0)
+            {
+                length = 3;
+                ret = lead & 0x0f;
+            }
+            else if ((lead & 0xf8) == 0xf0)
+            {
+                length = 4;
+                ret = lead & 0x07;
+            }
+            else
+            {
+                length = 0;
+                return 0;
+            }
+
+            if (end - it < static_cast<std::ptrdiff_t>(length))
+            {
+                length = 0;
+                return 0;
+            }
+
+            for (std::size_t i = 1; i < length; ++i)
+            {
+                auto cont = static_cast<unsigned char>(it[i]);
+                if ((cont & 0xc0) != 0x80)
+                {
+                    length = 0;
+                    return 0;
+                }
+
+                ret = (ret << 6) | (cont & 0x3f);
+            }
+
+            return ret;
+        }
+
+        // the actual lexing loop, shared between the token buffer and the threaded iterator backend
+        // works directly on UTF-8 input; code points are only decoded when a non-ASCII byte is encountered
+        // token strings are views into `source`, which needs to outlive all the produced tokens
+        // every produced token is handed to `emit`; errors are reported by throwing
+        // `end_flag`, if provided, allows the owner to stop the loop early
+        template<typename F>
+        void _lex(std::string_view source,
+            std::optional<std::string_view> file_path,
+            F && emit,
+            const std::atomic<bool> * end_flag = nullptr)
+        {
+            const char * const begin = source.data();
+            const char * const end = source.data() + source.size();
+            const char * cur = begin;
+
+            auto file = register_source(file_path, source);
+
+            // positions are just byte offsets, so nothing needs to be tracked while moving through the input
+            auto here = [&](const char * it) {
+                return position(static_cast<std::uint32_t>(it - begin), file);
+            };
+
+            auto decode = [&](const char * it, std::size_t & length) {
+                auto ret = _decode_utf8(it, end, length);
+                if (!length)
+                {
+                    throw exception(logger::fatal)
+                        << range_type{ here(it), here(it) } << ": invalid UTF-8 sequence in file";
+                }
+                return ret;
+            };
+
+            auto get = [&]() -> std::optional<char32_t> {
+                if (cur == end)
+                {
+                    return {};
+                }
+
+                std::size_t length;
+                auto ret = decode(cur, length);
+                cur += length;
+                return ret;
+            };
+
+            auto peek = [&](std::size_t x = 0) -> std::optional<char32_t> {
+                auto it = cur;
+                std::size_t length = 0;
+                char32_t ret = 0;
+
+                for (std::size_t i = 0; i <= x; ++i)
+                {
+                    it += length;
+                    if (it == end)
+                    {
+                        return {};
+                    }
+
+                    ret = decode(it, length);
+                }
+
+                return ret;
+            };
+
+            const auto & scan = _get_scanner();
+
+            // the text of a token starting at `start` and ending with the last code point returned by get()
+            auto text = [&](const char * start) { return std::string_view(start, cur - start); };
+
+            auto generate_token = [&](token_type type, const char * start) {
+                emit(token{ type, text(start), range_type(here(start), here(cur)) });
+            };
+
+            auto is_identifier_start = [](char32_t c) {
+                return (c >= U'a' && c <= U'z') || (c >= U'A' && c <= U'Z') || c == U'_';
+            };
+
+            auto is_decimal = [&](char32_t c) { return c >= U'0' && c <= U'9'; };
+
+            while ((!end_flag || !*end_flag) && cur != end)
+            {
+                if (auto skipped = scan.skip_white_space(cur, end); skipped != cur)
+                {
+                    cur = skipped;
+                    continue;
+                }
+
+                auto start = cur;
+                auto next = get();
+
+                if (next == U'/')
+                {
+                    auto second = peek();
+
+                    if (second == U'/')
+                    {
+                        cur = scan.find_line_end(cur, end);
+                        continue;
+                    }
+
+                    if (second == U'*')
+                    {
+                        get();
+
+                        cur = scan.find_comment_end(cur, end);
+
+                        if (cur == end)
+                        {
+                            throw unterminated_comment{ { here(start), here(cur) } };
+                        }
+
+                        get();
+                        get();
+                        continue;
+                    }
+                }
+
+                if (auto [type, length] = _match_symbol(start, end); type != token_type::none)
+                {
+                    cur = start + length;
+                    generate_token(type, start);
+                    continue;
+                }
+
+                if (next == U'"')
+                {
+                    auto second = peek();
+
+                    while (next && second && (second != U'"' || next == U'\\')
+                        && (second != U'\n' || next == U'\\'))
+                    {
+                        next = get();
+                        second = peek();
+                    }
+
+                    if (!next || second == U'\n')
+                    {
+                        throw unterminated_string{ { here(start), here(cur) } };
+                    }
+
+                    get();
+
+                    generate_token(token_type::string, start);
+                    continue;
+                }
+
+                if (is_identifier_start(*next))
+                {
+                    cur = scan.skip_identifier(cur, end);
+
+                    auto type = _classify_identifier(text(start));
+                    if (type == token_type::identifier)
+                    {
+                        token tok{ type, text(start), range_type(here(start), here(cur)) };
+                        tok.name = interned_string::from_utf8(tok.string);
+                        emit(std::move(tok));
+                        continue;
+                    }
+
+                    generate_token(type, start);
+                    continue;
+                }
+
+                if (is_decimal(*next))
+                {
+                    cur = scan.skip_decimal(cur, end);
+                    next = cur[-1];
+
+                    generate_token(token_type::integer, start);
+
+                    if (next && is_identifier_start(*next))
+                    {
+                        start = cur - 1;
+                        cur = scan.skip_identifier(cur, end);
+
+                        generate_token(token_type::integer_suffix, start);
+                    }
+
+                    continue;
+                }
+
+                throw exception(logger::fatal) << "stray character in file: " << text(start);
+            }
+        }
+    }
+}
+}
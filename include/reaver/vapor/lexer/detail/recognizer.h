@@ -0,0 +1,47 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+#include "../token.h"
+
+namespace reaver::vapor::lexer
+{
+inline namespace _v1
+{
+    namespace _detail
+    {
+        // both are driven by a single automaton, built at compile time from token_table
+
+        // returns the type of the longest symbol spelled at the beginning of [it, end)
+        // and its length in bytes, or token_type::none when there's no such symbol
+        std::pair<token_type, std::size_t> _match_symbol(const char * it, const char * end);
+
+        // returns the type of the keyword spelled by `identifier`, or token_type::identifier
+        token_type _classify_identifier(std::string_view identifier);
+    }
+}
+}
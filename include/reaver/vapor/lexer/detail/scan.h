@@ -0,0 +1,65 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <vector>
+
+namespace reaver::vapor::lexer
+{
+inline namespace _v1
+{
+    // the implementations of the bulk scanning routines the lexer uses to skip over
+    // runs of whitespace, comments, identifier characters and digits
+    // the best one supported by the CPU is selected at startup
+    enum class scanner_kind
+    {
+        scalar,
+        sse2,
+        avx2
+    };
+
+    const char * scanner_name(scanner_kind kind);
+    std::vector<scanner_kind> available_scanners();
+    scanner_kind selected_scanner();
+    // not thread safe; meant for benchmarks and tests
+    void select_scanner(scanner_kind kind);
+
+    namespace _detail
+    {
+        // every routine takes a [begin, end) range of UTF-8 bytes and returns
+        // a pointer to the first byte that doesn't belong to the scanned run, or `end`
+        struct _scanner
+        {
+            const char * (*skip_white_space)(const char *, const char *);
+            const char * (*skip_identifier)(const char *, const char *);
+            const char * (*skip_decimal)(const char *, const char *);
+            // returns a pointer to the first '\n'
+            const char * (*find_line_end)(const char *, const char *);
+            // returns a pointer to the '*' of the first "*/"
+            const char * (*find_comment_end)(const char *, const char *);
+        };
+
+        const _scanner & _get_scanner();
+    }
+}
+}
@@ -0,0 +1,173 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <cstdint>
+
+namespace reaver::vapor::lexer
+{
+inline namespace _v1
+{
+    namespace _detail
+    {
+        // vectorized implementations of the _scanner routines, generic over the instruction set
+        // `Ops` provides the vector type and the handful of byte-wise operations needed
+        // Ops types are meant to be defined in an anonymous namespace of a translation unit built with
+        // the matching target flags, which gives every instantiation internal linkage, so that code
+        // compiled for a wider instruction set can never be picked by the linker for another one
+        template<typename Ops>
+        struct _simd_scan
+        {
+            using vec = typename Ops::vec;
+            static constexpr std::uint32_t full_mask =
+                Ops::width == 32 ? ~std::uint32_t() : (1u << Ops::width) - 1;
+
+            static vec in_range(vec v, char lo, char hi)
+            {
+                // all the ranges are ASCII, so signed comparisons also reject every byte >= 0x80
+                return Ops::and_(Ops::gt(v, Ops::set(lo - 1)), Ops::gt(Ops::set(hi + 1), v));
+            }
+
+            static bool is_white_space(char c)
+            {
+                return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+            }
+
+            static bool is_decimal(char c)
+            {
+                return c >= '0' && c <= '9';
+            }
+
+            static bool is_identifier(char c)
+            {
+                return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || is_decimal(c);
+            }
+
+            static const char * skip_white_space(const char * it, const char * end)
+            {
+                for (; end - it >= Ops::width; it += Ops::width)
+                {
+                    auto v = Ops::load(it);
+                    auto ws = Ops::or_(Ops::or_(Ops::eq(v, Ops::set(' ')), Ops::eq(v, Ops::set('\t'))),
+                        Ops::or_(Ops::eq(v, Ops::set('\n')), Ops::eq(v, Ops::set('\r'))));
+
+                    if (auto bits = ~Ops::mask(ws) & full_mask)
+                    {
+                        return it + __builtin_ctz(bits);
+                    }
+                }
+
+                while (it != end && is_white_space(*it))
+                {
+                    ++it;
+                }
+
+                return it;
+            }
+
+            static const char * skip_identifier(const char * it, const char * end)
+            {
+                for (; end - it >= Ops::width; it += Ops::width)
+                {
+                    auto v = Ops::load(it);
+                    auto id = Ops::or_(Ops::or_(in_range(v, 'a', 'z'), in_range(v, 'A', 'Z')),
+                        Ops::or_(in_range(v, '0', '9'), Ops::eq(v, Ops::set('_'))));
+
+                    if (auto bits = ~Ops::mask(id) & full_mask)
+                    {
+                        return it + __builtin_ctz(bits);
+                    }
+                }
+
+                while (it != end && is_identifier(*it))
+                {
+                    ++it;
+                }
+
+                return it;
+            }
+
+            static const char * skip_decimal(const char * it, const char * end)
+            {
+                for (; end - it >= Ops::width; it += Ops::width)
+                {
+                    if (auto bits = ~Ops::mask(in_range(Ops::load(it), '0', '9')) & full_mask)
+                    {
+                        return it + __builtin_ctz(bits);
+                    }
+                }
+
+                while (it != end && is_decimal(*it))
+                {
+                    ++it;
+                }
+
+                return it;
+            }
+
+            static const char * find_line_end(const char * it, const char * end)
+            {
+                for (; end - it >= Ops::width; it += Ops::width)
+                {
+                    if (auto bits = Ops::mask(Ops::eq(Ops::load(it), Ops::set('\n'))))
+                    {
+                        return it + __builtin_ctz(bits);
+                    }
+                }
+
+                while (it != end && *it != '\n')
+                {
+                    ++it;
+                }
+
+                return it;
+            }
+
+            static const char * find_comment_end(const char * it, const char * end)
+            {
+                // the second load is shifted by a byte; its lane i holds the byte after lane i of the first
+                for (; end - it > Ops::width; it += Ops::width)
+                {
+                    auto stars = Ops::eq(Ops::load(it), Ops::set('*'));
+                    auto slashes = Ops::eq(Ops::load(it + 1), Ops::set('/'));
+
+                    if (auto bits = Ops::mask(Ops::and_(stars, slashes)))
+                    {
+                        return it + __builtin_ctz(bits);
+                    }
+                }
+
+                for (; end - it >= 2; ++it)
+                {
+                    if (it[0] == '*' && it[1] == '/')
+                    {
+                        return it;
+                    }
+                }
+
+                return end;
+            }
+        };
+    }
+}
+}
@@ -23,7 +23,8 @@
 #pragma once
 
 #include <memory>
-#include <type_traits>
+#include <optional>
+#include <string_view>
 
 #include "detail/iterator_backend.h"
 
@@ -36,12 +37,9 @@ inline namespace _v1
     public:
         iterator() = default;
 
-        template<typename Iter,
-            typename std::enable_if<
-                std::is_same<typename std::iterator_traits<Iter>::value_type, char32_t>::value,
-                int>::type = 0>
-        iterator(Iter begin, Iter end, std::optional<std::string_view> filename)
-            : _backend{ std::make_shared<_detail::_iterator_backend>(begin, end, _node, filename) }
+        // `source` is UTF-8 and needs to outlive all the tokens produced
+        iterator(std::string_view source, std::optional<std::string_view> filename)
+            : _backend{ std::make_shared<_detail::_iterator_backend>(source, _node, filename) }
         {
         }
 
@@ -24,11 +24,12 @@
 
 #include <array>
 #include <ostream>
+#include <string_view>
 #include <type_traits>
-#include <unordered_map>
 
 #include <reaver/exception.h>
 
+#include "../interned_string.h"
 #include "../range.h"
 #include "../utf.h"
 
@@ -157,14 +158,152 @@ inline namespace _v1
         }
     }
 
-    extern std::array<std::string, +token_type::count> token_types;
+    // the kinds of entries in the token table
+    // special tokens only have a descriptive name; keywords and symbols are recognized by their spelling
+    enum class token_kind
+    {
+        special,
+        keyword,
+        symbol
+    };
+
+    struct token_description
+    {
+        token_type type;
+        std::string_view spelling;
+        token_kind kind;
+        // an alias is an additional spelling of a token type that isn't used as its name
+        bool alias = false;
+    };
+
+    // the single source of names and spellings of tokens
+    // token_types, the keyword table and the lexer's operator recognizer are all derived from it
+    inline constexpr token_description token_table[] = {
+        { token_type::none, "<EMPTY TOKEN>", token_kind::special },
+        { token_type::identifier, "identifier", token_kind::special },
+        { token_type::string, "string", token_kind::special },
+        { token_type::string_suffix, "string-suffix", token_kind::special },
+        { token_type::integer, "integer", token_kind::special },
+        { token_type::integer_suffix, "integer-suffix", token_kind::special },
+        { token_type::boolean, "boolean", token_kind::special },
+        { token_type::boolean, "true", token_kind::keyword, true },
+        { token_type::boolean, "false", token_kind::keyword, true },
+
+        { token_type::module, "module", token_kind::keyword },
+        { token_type::import, "import", token_kind::keyword },
+        { token_type::export_, "export", token_kind::keyword },
+
+        { token_type::let, "let", token_kind::keyword },
+        { token_type::return_, "return", token_kind::keyword },
+        { token_type::function, "function", token_kind::keyword },
+        { token_type::struct_, "struct", token_kind::keyword },
+
+        { token_type::typeclass, "typeclass", token_kind::keyword },
+        { token_type::implicit, "implicit", token_kind::keyword },
+        { token_type::instance, "instance", token_kind::keyword },
+        { token_type::default_, "default", token_kind::keyword },
+
+        { token_type::if_, "if", token_kind::keyword },
+        { token_type::else_, "else", token_kind::keyword },
+
+        { token_type::dot, ".", token_kind::symbol },
+        { token_type::comma, ",", token_kind::symbol },
+        { token_type::curly_bracket_open, "{", token_kind::symbol },
+        { token_type::curly_bracket_close, "}", token_kind::symbol },
+        { token_type::square_bracket_open, "[", token_kind::symbol },
+        { token_type::square_bracket_close, "]", token_kind::symbol },
+        { token_type::round_bracket_open, "(", token_kind::symbol },
+        { token_type::round_bracket_close, ")", token_kind::symbol },
+        { token_type::angle_bracket_open, "<", token_kind::symbol },
+        { token_type::angle_bracket_close, ">", token_kind::symbol },
+        { token_type::colon, ":", token_kind::symbol },
+        { token_type::semicolon, ";", token_kind::symbol },
+        { token_type::map, "->>", token_kind::symbol },
+        { token_type::indirection, "->", token_kind::symbol },
+        { token_type::assign, "=", token_kind::symbol },
+        { token_type::block_value, "=>", token_kind::symbol },
+
+        { token_type::logical_not, "!", token_kind::symbol },
+        { token_type::bitwise_not, "~", token_kind::symbol },
+        { token_type::bitwise_not_assignment, "~=", token_kind::symbol },
+
+        { token_type::plus, "+", token_kind::symbol },
+        { token_type::minus, "-", token_kind::symbol },
+        { token_type::star, "*", token_kind::symbol },
+        { token_type::slash, "/", token_kind::symbol },
+        { token_type::modulo, "%", token_kind::symbol },
+        { token_type::bitwise_and, "&", token_kind::symbol },
+        { token_type::bitwise_or, "|", token_kind::symbol },
+        { token_type::bitwise_xor, "^", token_kind::symbol },
+        { token_type::logical_and, "&&", token_kind::symbol },
+        { token_type::logical_or, "||", token_kind::symbol },
+        { token_type::right_shift, ">>", token_kind::symbol },
+        { token_type::left_shift, "<<", token_kind::symbol },
+
+        { token_type::plus_assignment, "+=", token_kind::symbol },
+        { token_type::minus_assignment, "-=", token_kind::symbol },
+        { token_type::star_assignment, "*=", token_kind::symbol },
+        { token_type::slash_assignment, "/=", token_kind::symbol },
+        { token_type::modulo_assignment, "%=", token_kind::symbol },
+        { token_type::bitwise_and_assignment, "&=", token_kind::symbol },
+        { token_type::bitwise_or_assignment, "|=", token_kind::symbol },
+        { token_type::bitwise_xor_assignment, "^=", token_kind::symbol },
+        { token_type::logical_and_assignment, "&&=", token_kind::symbol },
+        { token_type::logical_or_assignment, "||=", token_kind::symbol },
+        { token_type::right_shift_assignment, ">>=", token_kind::symbol },
+        { token_type::left_shift_assignment, "<<=", token_kind::symbol },
+
+        { token_type::equals, "==", token_kind::symbol },
+        { token_type::not_equals, "!=", token_kind::symbol },
+        { token_type::less_equal, "<=", token_kind::symbol },
+        { token_type::greater_equal, ">=", token_kind::symbol },
+
+        { token_type::increment, "++", token_kind::symbol },
+        { token_type::decrement, "--", token_kind::symbol },
+
+        { token_type::bind, "bind", token_kind::special },
+
+        { token_type::lambda, u8"λ", token_kind::symbol },
+        { token_type::lambda, "lambda", token_kind::keyword, true },
+    };
+
+    namespace _detail
+    {
+        constexpr auto _make_token_names()
+        {
+            std::array<std::string_view, +token_type::count> ret{};
+
+            for (auto && desc : token_table)
+            {
+                if (!desc.alias)
+                {
+                    ret[+desc.type] = desc.spelling;
+                }
+            }
+
+            return ret;
+        }
+
+        constexpr bool _all_tokens_named()
+        {
+            auto names = _make_token_names();
+
+            for (auto && name : names)
+            {
+                if (name.empty())
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }
+
+    static_assert(_detail::_all_tokens_named(),
+        "every token type needs a non-alias entry in the token table");
 
-    extern const std::unordered_map<std::u32string, token_type> keywords;
-    extern const std::unordered_map<char32_t, token_type> symbols1;
-    extern const std::unordered_map<char32_t, std::unordered_map<char32_t, token_type>> symbols2;
-    extern const std::unordered_map<char32_t,
-        std::unordered_map<char32_t, std::unordered_map<char32_t, token_type>>>
-        symbols3;
+    inline constexpr auto token_types = _detail::_make_token_names();
 
     class iterator;
 
@@ -178,14 +317,16 @@ inline namespace _v1
         token & operator=(const token &) = default;
         token & operator=(token &&) = default;
 
-        token(token_type t, std::u32string s, range_type r)
-            : type{ t }, string{ std::move(s) }, range{ std::move(r) }
+        token(token_type t, std::string_view s, range_type r) : type{ t }, string{ s }, range{ std::move(r) }
         {
         }
 
         token_type type;
-        std::u32string string;
+        // UTF-8 view into the lexed source; the source must outlive the token
+        std::string_view string;
         range_type range;
+        // set for identifiers only; interned once here so later stages never hash the text again
+        interned_string name;
     };
 
     inline bool operator==(const token & lhs, const token & rhs)
@@ -195,7 +336,7 @@ inline namespace _v1
 
     inline std::ostream & operator<<(std::ostream & os, const token & tok)
     {
-        return os << "token type: `" << token_types[+tok.type] << "` token value: `" << utf8(tok.string)
+        return os << "token type: `" << token_types[+tok.type] << "` token value: `" << tok.string
                   << "` token range: " << tok.range;
     };
 }
@@ -0,0 +1,236 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "detail/lex.h"
+#include "iterator.h"
+#include "token.h"
+
+namespace reaver::vapor::lexer
+{
+inline namespace _v1
+{
+    // a random access cursor into a token_buffer
+    // a default constructed buffer_iterator compares equal to any iterator that reached the end of its
+    // buffer, which keeps the `end = {}` convention of the streaming iterator working
+    class buffer_iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = token;
+        using difference_type = std::ptrdiff_t;
+        using pointer = token *;
+        using reference = token &;
+
+        buffer_iterator() = default;
+
+        buffer_iterator(token * base, std::size_t size, std::size_t index)
+            : _base{ base }, _size{ size }, _index{ index }
+        {
+        }
+
+        explicit operator bool() const
+        {
+            return !_at_end();
+        }
+
+        std::size_t index() const
+        {
+            return _index;
+        }
+
+        token & operator*() const
+        {
+            return _base[_index];
+        }
+
+        token * operator->() const
+        {
+            return _base + _index;
+        }
+
+        token & operator[](difference_type offset) const
+        {
+            return _base[_index + offset];
+        }
+
+        buffer_iterator & operator++()
+        {
+            ++_index;
+            return *this;
+        }
+
+        buffer_iterator operator++(int)
+        {
+            auto ret = *this;
+            ++_index;
+            return ret;
+        }
+
+        buffer_iterator & operator--()
+        {
+            --_index;
+            return *this;
+        }
+
+        buffer_iterator operator--(int)
+        {
+            auto ret = *this;
+            --_index;
+            return ret;
+        }
+
+        buffer_iterator & operator+=(difference_type offset)
+        {
+            _index += offset;
+            return *this;
+        }
+
+        buffer_iterator & operator-=(difference_type offset)
+        {
+            _index -= offset;
+            return *this;
+        }
+
+        buffer_iterator operator+(difference_type offset) const
+        {
+            auto ret = *this;
+            ret += offset;
+            return ret;
+        }
+
+        buffer_iterator operator-(difference_type offset) const
+        {
+            auto ret = *this;
+            ret -= offset;
+            return ret;
+        }
+
+        difference_type operator-(const buffer_iterator & rhs) const
+        {
+            return static_cast<difference_type>(_position()) - static_cast<difference_type>(rhs._position());
+        }
+
+        bool operator==(const buffer_iterator & rhs) const
+        {
+            if (!_base || !rhs._base)
+            {
+                return _at_end() && rhs._at_end();
+            }
+
+            return _index == rhs._index;
+        }
+
+        bool operator!=(const buffer_iterator & rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+        bool operator<(const buffer_iterator & rhs) const
+        {
+            return _position() < rhs._position();
+        }
+
+    private:
+        bool _at_end() const
+        {
+            return !_base || _index >= _size;
+        }
+
+        std::size_t _position() const
+        {
+            return _base ? _index : std::size_t(-1);
+        }
+
+        token * _base = nullptr;
+        std::size_t _size = 0;
+        std::size_t _index = 0;
+    };
+
+    // all tokens of a single source, lexed synchronously into contiguous storage
+    // this is the default path for the compiler; use lexer::iterator if lexing should overlap with parsing
+    class token_buffer
+    {
+    public:
+        token_buffer() = default;
+        token_buffer(const token_buffer &) = delete;
+        token_buffer(token_buffer &&) = default;
+        token_buffer & operator=(const token_buffer &) = delete;
+        token_buffer & operator=(token_buffer &&) = default;
+
+        // `source` is UTF-8 and needs to outlive the buffer, since tokens are views into it
+        token_buffer(std::string_view source, std::optional<std::string_view> filename)
+        {
+            _detail::_lex(source, filename, [&](token tok) { _tokens.push_back(std::move(tok)); });
+        }
+
+        // drains a streaming iterator
+        token_buffer(iterator begin, iterator end = {})
+        {
+            for (; begin != end; ++begin)
+            {
+                _tokens.push_back(*begin);
+            }
+        }
+
+        std::size_t size() const
+        {
+            return _tokens.size();
+        }
+
+        bool empty() const
+        {
+            return _tokens.empty();
+        }
+
+        token & operator[](std::size_t index)
+        {
+            return _tokens[index];
+        }
+
+        const token & operator[](std::size_t index) const
+        {
+            return _tokens[index];
+        }
+
+        buffer_iterator begin()
+        {
+            return { _tokens.data(), _tokens.size(), 0 };
+        }
+
+        buffer_iterator end()
+        {
+            return { _tokens.data(), _tokens.size(), _tokens.size() };
+        }
+
+    private:
+        std::vector<token> _tokens;
+    };
+}
+}
@@ -0,0 +1,380 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace reaver::vapor::parser
+{
+inline namespace _v1
+{
+    // a bump allocator backing a single parse tree
+    // nodes allocated from it are never destroyed individually, which is why they must be trivially
+    // destructible; the whole tree goes away at once, together with the arena
+    class arena
+    {
+    public:
+        arena(bool synchronized = false) : _synchronized{ synchronized }
+        {
+        }
+
+        arena(const arena &) = delete;
+        arena & operator=(const arena &) = delete;
+
+        void * allocate(std::size_t size, std::size_t alignment)
+        {
+            if (_synchronized)
+            {
+                std::lock_guard<std::mutex> lock{ _lock };
+                return _allocate(size, alignment);
+            }
+
+            return _allocate(size, alignment);
+        }
+
+        template<typename T, typename... Args>
+        T * make(Args &&... args)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "arena-allocated nodes are never destroyed");
+            return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        // takes over the blocks of another arena, so that nodes allocated from it live as long as this one
+        // used to gather trees parsed on separate threads
+        void adopt(arena && other);
+
+        std::size_t block_count() const
+        {
+            return _blocks.size();
+        }
+
+    private:
+        void * _allocate(std::size_t size, std::size_t alignment)
+        {
+            auto aligned = (_current + alignment - 1) & ~(alignment - 1);
+            if (aligned + size > _current_end)
+            {
+                // don't throw away the rest of the current block for something that wouldn't fit in the next
+                // one either
+                if (size + alignment > _next_block_size / 2)
+                {
+                    return _allocate_dedicated(size, alignment);
+                }
+
+                _grow();
+                aligned = (_current + alignment - 1) & ~(alignment - 1);
+            }
+
+            _current = aligned + size;
+            return reinterpret_cast<void *>(aligned);
+        }
+
+        void _grow();
+        void * _allocate_dedicated(std::size_t size, std::size_t alignment);
+
+        std::vector<std::unique_ptr<char[]>> _blocks;
+        std::uintptr_t _current = 0;
+        std::uintptr_t _current_end = 0;
+        std::size_t _next_block_size = 64 * 1024;
+
+        bool _synchronized;
+        std::mutex _lock;
+    };
+
+    // the arena new nodes are allocated from on this thread
+    // outside of an arena_scope this is a process-wide arena that is never freed, so that nodes built by hand
+    // (in tests, or synthesized by later stages) have somewhere to live
+    arena & current_arena();
+
+    class arena_scope
+    {
+    public:
+        arena_scope(arena & a);
+        ~arena_scope();
+
+        arena_scope(const arena_scope &) = delete;
+        arena_scope & operator=(const arena_scope &) = delete;
+
+    private:
+        arena * _previous;
+    };
+
+    // an owning-by-arena pointer to a child node; stands in for recursive_wrapper
+    // the tree is immutable once parsed, so copies share the pointee instead of cloning it
+    template<typename T>
+    class node_ptr
+    {
+    public:
+        node_ptr() : node_ptr(T{})
+        {
+        }
+
+        node_ptr(const T & value) : _ptr{ current_arena().template make<T>(value) }
+        {
+        }
+
+        node_ptr(T && value) : _ptr{ current_arena().template make<T>(std::move(value)) }
+        {
+        }
+
+        const T & get() const
+        {
+            return *_ptr;
+        }
+
+        T & get()
+        {
+            return *_ptr;
+        }
+
+        operator const T &() const
+        {
+            return *_ptr;
+        }
+
+        operator T &()
+        {
+            return *_ptr;
+        }
+
+        const T & operator*() const
+        {
+            return *_ptr;
+        }
+
+        T & operator*()
+        {
+            return *_ptr;
+        }
+
+        const T * operator->() const
+        {
+            return _ptr;
+        }
+
+        T * operator->()
+        {
+            return _ptr;
+        }
+
+    private:
+        T * _ptr;
+    };
+
+    template<typename T>
+    bool operator==(const node_ptr<T> & lhs, const node_ptr<T> & rhs)
+    {
+        return lhs.get() == rhs.get();
+    }
+
+    template<typename T>
+    bool operator!=(const node_ptr<T> & lhs, const node_ptr<T> & rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template<typename T>
+    const T & unwrap(const T & value)
+    {
+        return value;
+    }
+
+    template<typename T>
+    const T & unwrap(const node_ptr<T> & value)
+    {
+        return value.get();
+    }
+
+    // a list of child nodes, stored contiguously in the current arena
+    // it only ever grows while its node is being parsed; storage left behind by growing is reclaimed together
+    // with the rest of the arena
+    // like node_ptr, copies share the elements
+    template<typename T>
+    class node_list
+    {
+    public:
+        using value_type = T;
+        using iterator = T *;
+        using const_iterator = const T *;
+
+        node_list() = default;
+
+        node_list(std::initializer_list<T> values)
+        {
+            _reserve(values.size());
+            for (auto && value : values)
+            {
+                new (_data + _size++) T(value);
+            }
+        }
+
+        void push_back(T value)
+        {
+            if (_size == _capacity)
+            {
+                _reserve(_capacity ? _capacity * 2 : 4);
+            }
+
+            new (_data + _size++) T(std::move(value));
+        }
+
+        std::size_t size() const
+        {
+            return _size;
+        }
+
+        bool empty() const
+        {
+            return _size == 0;
+        }
+
+        T * begin()
+        {
+            return _data;
+        }
+
+        T * end()
+        {
+            return _data + _size;
+        }
+
+        const T * begin() const
+        {
+            return _data;
+        }
+
+        const T * end() const
+        {
+            return _data + _size;
+        }
+
+        T & operator[](std::size_t idx)
+        {
+            return _data[idx];
+        }
+
+        const T & operator[](std::size_t idx) const
+        {
+            return _data[idx];
+        }
+
+        T & front()
+        {
+            return _data[0];
+        }
+
+        const T & front() const
+        {
+            return _data[0];
+        }
+
+        T & back()
+        {
+            return _data[_size - 1];
+        }
+
+        const T & back() const
+        {
+            return _data[_size - 1];
+        }
+
+        // hidden friends, so that they don't shadow the other fmap overloads for code in this namespace
+        template<typename F>
+        friend auto fmap(const node_list & list, F && f)
+        {
+            std::vector<std::decay_t<std::invoke_result_t<F &, const T &>>> ret;
+            ret.reserve(list.size());
+            for (auto && elem : list)
+            {
+                ret.push_back(std::invoke(f, elem));
+            }
+            return ret;
+        }
+
+        template<typename F>
+        friend auto fmap(node_list & list, F && f)
+        {
+            std::vector<std::decay_t<std::invoke_result_t<F &, T &>>> ret;
+            ret.reserve(list.size());
+            for (auto && elem : list)
+            {
+                ret.push_back(std::invoke(f, elem));
+            }
+            return ret;
+        }
+
+    private:
+        void _reserve(std::size_t capacity)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "arena-allocated nodes are never destroyed");
+
+            auto data = static_cast<T *>(current_arena().allocate(sizeof(T) * capacity, alignof(T)));
+            for (std::uint32_t i = 0; i < _size; ++i)
+            {
+                new (data + i) T(std::move(_data[i]));
+            }
+
+            _data = data;
+            _capacity = static_cast<std::uint32_t>(capacity);
+        }
+
+        T * _data = nullptr;
+        std::uint32_t _size = 0;
+        std::uint32_t _capacity = 0;
+    };
+
+    template<typename T>
+    bool operator==(const node_list<T> & lhs, const node_list<T> & rhs)
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            if (!(lhs[i] == rhs[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    bool operator!=(const node_list<T> & lhs, const node_list<T> & rhs)
+    {
+        return !(lhs == rhs);
+    }
+}
+}
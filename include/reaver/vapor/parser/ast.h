@@ -22,9 +22,12 @@
 
 #pragma once
 
-#include <vector>
+#include <cstddef>
+#include <memory>
 
 #include "../lexer/iterator.h"
+#include "../lexer/token_buffer.h"
+#include "arena.h"
 
 namespace reaver::vapor::parser
 {
@@ -41,10 +44,18 @@ inline namespace _v1
         ast & operator=(const ast &) = delete;
         ast & operator=(ast &&) = default;
 
-        std::vector<import_expression> global_imports;
-        std::vector<module> module_definitions;
+        // owns every node of the tree below; held by pointer so that moving the ast doesn't move the nodes
+        std::unique_ptr<arena> nodes = std::make_unique<arena>();
+
+        node_list<import_expression> global_imports;
+        node_list<module> module_definitions;
     };
 
+    // top-level module definitions are parsed in parallel when there are enough tokens for that to pay off
+    // thread_count of 0 means one thread per core; 1 parses everything on the calling thread
+    ast parse_ast(lexer::buffer_iterator begin,
+        lexer::buffer_iterator end = {},
+        std::size_t thread_count = 0);
     ast parse_ast(lexer::iterator begin, lexer::iterator end = {});
     std::ostream & operator<<(std::ostream & os, const ast & ast);
 }
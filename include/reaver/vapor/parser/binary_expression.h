@@ -25,6 +25,7 @@
 #include "../lexer/token.h"
 #include "../range.h"
 #include "expression.h"
+#include "operators.h"
 #include "unary_expression.h"
 
 namespace reaver::vapor::parser
@@ -41,52 +42,9 @@ inline namespace _v1
 
     bool operator==(const binary_expression & lhs, const binary_expression & rhs);
 
-    const std::vector<lexer::token_type> & binary_operators();
-
-    inline bool is_binary_operator(lexer::token_type t)
-    {
-        return std::find(binary_operators().begin(), binary_operators().end(), t) != binary_operators().end();
-    }
-
-    const std::unordered_map<lexer::token_type, std::size_t> & binary_operator_precedences();
-
-    inline std::size_t precedence(operator_context ctx)
-    {
-        if (ctx.type == operator_type::unary)
-        {
-            return 5;
-        }
-
-        return binary_operator_precedences().at(ctx.op);
-    }
-
-    enum class assoc
-    {
-        right,
-        left
-    };
-
-    inline assoc associativity(lexer::token_type type)
-    {
-        static std::vector<lexer::token_type> right_assoc = { lexer::token_type::assign,
-            lexer::token_type::plus_assignment,
-            lexer::token_type::minus_assignment,
-            lexer::token_type::star_assignment,
-            lexer::token_type::slash_assignment,
-            lexer::token_type::left_shift_assignment,
-            lexer::token_type::right_shift_assignment,
-            lexer::token_type::bitwise_and_assignment,
-            lexer::token_type::bitwise_not_assignment,
-            lexer::token_type::bitwise_or_assignment,
-            lexer::token_type::bitwise_xor_assignment,
-            lexer::token_type::logical_and_assignment,
-            lexer::token_type::logical_or_assignment };
-
-        return std::find(right_assoc.begin(), right_assoc.end(), type) != right_assoc.end() ? assoc::right
-                                                                                            : assoc::left;
-    };
-
-    binary_expression parse_binary_expression(context & ctx, expression lhs);
+    binary_expression parse_binary_expression(context & ctx,
+        expression lhs,
+        expression_special_modes mode = expression_special_modes::none);
 
     void print(const binary_expression & expr, std::ostream & os, print_context ctx);
 }
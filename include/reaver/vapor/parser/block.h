@@ -36,7 +36,7 @@ inline namespace _v1
     struct block
     {
         range_type range;
-        std::vector<std::variant<recursive_wrapper<block>, recursive_wrapper<statement>>> block_value;
+        node_list<std::variant<node_ptr<block>, node_ptr<statement>>> block_value;
         std::optional<expression_list> value_expression;
     };
 
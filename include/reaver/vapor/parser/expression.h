@@ -32,6 +32,7 @@
 #include "import_expression.h"
 #include "literal.h"
 #include "member_expression.h"
+#include "operators.h"
 #include "postfix_expression.h"
 
 namespace reaver::vapor::parser
@@ -51,25 +52,31 @@ inline namespace _v1
     struct expression
     {
         range_type range;
-        std::variant<literal<lexer::token_type::string>,
-            literal<lexer::token_type::integer>,
-            literal<lexer::token_type::boolean>,
-            member_expression, // this might need to be pulled into postfix expressions later on
-                               // (if I want to make this work more like complex lenses)
-            postfix_expression,
-            import_expression,
-            recursive_wrapper<lambda_expression>,
-            recursive_wrapper<unary_expression>,
-            recursive_wrapper<binary_expression>,
-            recursive_wrapper<struct_literal>,
-            recursive_wrapper<typeclass_literal>,
-            recursive_wrapper<instance_literal>>
+        // every alternative lives in the arena, so that expressions stay small and building a chain of binary
+        // expressions doesn't copy its operands around
+        std::variant<node_ptr<literal<lexer::token_type::string>>,
+            node_ptr<literal<lexer::token_type::integer>>,
+            node_ptr<literal<lexer::token_type::boolean>>,
+            node_ptr<member_expression>, // this might need to be pulled into postfix expressions later on
+                                         // (if I want to make this work more like complex lenses)
+            node_ptr<postfix_expression>,
+            node_ptr<import_expression>,
+            node_ptr<lambda_expression>,
+            node_ptr<unary_expression>,
+            node_ptr<binary_expression>,
+            node_ptr<struct_literal>,
+            node_ptr<typeclass_literal>,
+            node_ptr<instance_literal>>
             expression_value = postfix_expression();
     };
 
     bool operator==(const expression & lhs, const expression & rhs);
 
-    expression parse_expression(context & ctx, expression_special_modes = expression_special_modes::none);
+    // parses an expression; binary operators that don't bind tighter than precedence_limit (or as tight, for
+    // right-associative ones) are left for the caller
+    expression parse_expression(context & ctx,
+        expression_special_modes = expression_special_modes::none,
+        std::size_t precedence_limit = no_precedence_limit);
 
     void print(const expression & expr, std::ostream & os, print_context ctx);
 }
@@ -36,7 +36,7 @@ inline namespace _v1
     struct expression_list
     {
         range_type range;
-        std::vector<expression> expressions;
+        node_list<expression> expressions;
     };
 
     bool operator==(const expression_list & lhs, const expression_list & rhs);
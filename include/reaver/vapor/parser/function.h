@@ -48,7 +48,7 @@ inline namespace _v1
     {
         range_type range;
         function_declaration signature;
-        recursive_wrapper<block> body;
+        node_ptr<block> body;
     };
 
     bool operator==(const function_declaration & lhs, const function_declaration & rhs);
@@ -27,10 +27,11 @@
 #include <reaver/exception.h>
 #include <reaver/unit.h>
 
-#include "../lexer/iterator.h"
 #include "../lexer/token.h"
+#include "../lexer/token_buffer.h"
 #include "../range.h"
 #include "../utf.h"
+#include "arena.h"
 
 namespace reaver::vapor::parser
 {
@@ -39,17 +40,16 @@ inline namespace _v1
     class expectation_failure : public exception
     {
     public:
-        expectation_failure(lexer::token_type expected, const std::u32string & actual, range_type & r)
+        expectation_failure(lexer::token_type expected, std::string_view actual, range_type & r)
             : exception{ logger::fatal }
         {
-            *this << r << ": expected `" << lexer::token_types[+expected] << "`, got `" << utf8(actual)
-                  << "`";
+            *this << r << ": expected `" << lexer::token_types[+expected] << "`, got `" << actual << "`";
         }
 
-        expectation_failure(const std::string & str, const std::u32string & actual, range_type & r)
+        expectation_failure(const std::string & str, std::string_view actual, range_type & r)
             : exception{ logger::fatal }
         {
-            *this << r << ": expected " << str << ", got `" << utf8(actual) << "`";
+            *this << r << ": expected " << str << ", got `" << actual << "`";
         }
 
         expectation_failure(lexer::token_type expected) : exception{ logger::fatal }
@@ -63,18 +63,6 @@ inline namespace _v1
         }
     };
 
-    enum class operator_type
-    {
-        unary,
-        binary
-    };
-
-    struct operator_context
-    {
-        lexer::token_type op;
-        operator_type type;
-    };
-
     enum class expression_special_modes
     {
         none,
@@ -84,20 +72,19 @@ inline namespace _v1
 
     struct context
     {
-        lexer::iterator begin, end;
-        std::vector<operator_context> operator_stack;
+        lexer::buffer_iterator begin, end;
     };
 
     inline lexer::token expect(context & ctx, lexer::token_type expected)
     {
-        if (ctx.begin->type != expected)
+        if (ctx.begin == ctx.end)
         {
-            throw expectation_failure{ expected, ctx.begin->string, ctx.begin->range };
+            throw expectation_failure{ expected };
         }
 
-        if (ctx.begin == ctx.end)
+        if (ctx.begin->type != expected)
         {
-            throw expectation_failure{ expected };
+            throw expectation_failure{ expected, ctx.begin->string, ctx.begin->range };
         }
 
         return std::move(*ctx.begin++);
@@ -38,7 +38,7 @@ inline namespace _v1
     struct id_expression
     {
         range_type range;
-        std::vector<identifier> id_expression_value;
+        node_list<identifier> id_expression_value;
     };
 
     bool operator==(const id_expression & lhs, const id_expression & rhs);
@@ -34,8 +34,8 @@ inline namespace _v1
     {
         range_type range;
         expression condition;
-        recursive_wrapper<block> then_block;
-        std::optional<recursive_wrapper<block>> else_block;
+        node_ptr<block> then_block;
+        std::optional<node_ptr<block>> else_block;
     };
 
     bool operator==(const if_statement & lhs, const if_statement & rhs);
@@ -78,7 +78,7 @@ inline namespace _v1
     {
         os << styles::def << ctx << styles::rule_name << lexer::token_types[+lit.value.type];
         print_address_range(os, lit);
-        os << " '" << styles::string_value << utf8(lit.value.string) << styles::def << "'";
+        os << " '" << styles::string_value << lit.value.string << styles::def << "'";
 
         assert(!lit.suffix);
 
@@ -37,9 +37,11 @@ inline namespace _v1
     {
         range_type range;
         id_expression name;
-        std::vector<statement> statements;
+        node_list<statement> statements;
     };
 
+    bool operator==(const module & lhs, const module & rhs);
+
     module parse_module(context & ctx);
     void print(const module & mod, std::ostream & os, print_context ctx);
 }
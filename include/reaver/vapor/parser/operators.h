@@ -0,0 +1,145 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+
+#include "../lexer/token.h"
+
+namespace reaver::vapor::parser
+{
+inline namespace _v1
+{
+    enum class assoc
+    {
+        right,
+        left
+    };
+
+    struct operator_description
+    {
+        bool unary = false;
+        bool binary = false;
+        // for binary operators; lower values bind tighter
+        std::uint8_t precedence = 0;
+        assoc associativity = assoc::left;
+    };
+
+    // unary operators bind tighter than every binary operator except for indirection
+    inline constexpr std::size_t unary_precedence = 5;
+    inline constexpr std::size_t no_precedence_limit = std::numeric_limits<std::size_t>::max();
+
+    namespace _detail
+    {
+        constexpr auto _make_operator_table()
+        {
+            using lexer::token_type;
+
+            std::array<operator_description, +token_type::count> ret{};
+
+            for (auto type : { token_type::plus,
+                     token_type::minus,
+                     token_type::logical_not,
+                     token_type::bitwise_not,
+                     token_type::star,
+                     token_type::increment,
+                     token_type::decrement })
+            {
+                ret[+type].unary = true;
+            }
+
+            auto binary = [&](auto types, std::uint8_t precedence, assoc associativity) {
+                for (auto type : types)
+                {
+                    ret[+type].binary = true;
+                    ret[+type].precedence = precedence;
+                    ret[+type].associativity = associativity;
+                }
+            };
+
+            using list = std::initializer_list<token_type>;
+
+            binary(list{ token_type::indirection }, 0, assoc::left);
+            binary(list{ token_type::star, token_type::slash, token_type::modulo }, 10, assoc::left);
+            binary(list{ token_type::plus, token_type::minus }, 15, assoc::left);
+            binary(list{ token_type::left_shift, token_type::right_shift }, 20, assoc::left);
+            binary(list{ token_type::less,
+                       token_type::less_equal,
+                       token_type::greater,
+                       token_type::greater_equal },
+                25,
+                assoc::left);
+            binary(list{ token_type::equals, token_type::not_equals }, 30, assoc::left);
+            binary(list{ token_type::bitwise_and }, 35, assoc::left);
+            binary(list{ token_type::bitwise_xor }, 40, assoc::left);
+            binary(list{ token_type::bitwise_or }, 45, assoc::left);
+            binary(list{ token_type::logical_and }, 50, assoc::left);
+            binary(list{ token_type::logical_or }, 55, assoc::left);
+            binary(list{ token_type::map, token_type::bind }, 58, assoc::left);
+            binary(list{ token_type::assign,
+                       token_type::plus_assignment,
+                       token_type::minus_assignment,
+                       token_type::star_assignment,
+                       token_type::slash_assignment,
+                       token_type::modulo_assignment,
+                       token_type::bitwise_and_assignment,
+                       token_type::bitwise_or_assignment,
+                       token_type::bitwise_xor_assignment,
+                       token_type::logical_and_assignment,
+                       token_type::logical_or_assignment,
+                       token_type::left_shift_assignment,
+                       token_type::right_shift_assignment },
+                60,
+                assoc::right);
+
+            return ret;
+        }
+    }
+
+    inline constexpr auto operator_table = _detail::_make_operator_table();
+
+    inline constexpr bool is_unary_operator(lexer::token_type type)
+    {
+        return operator_table[+type].unary;
+    }
+
+    inline constexpr bool is_binary_operator(lexer::token_type type)
+    {
+        return operator_table[+type].binary;
+    }
+
+    inline constexpr std::size_t precedence(lexer::token_type type)
+    {
+        return operator_table[+type].precedence;
+    }
+
+    inline constexpr assoc associativity(lexer::token_type type)
+    {
+        return operator_table[+type].associativity;
+    }
+}
+}
@@ -40,7 +40,7 @@ inline namespace _v1
     struct parameter_list
     {
         range_type range;
-        std::vector<parameter> parameters;
+        node_list<parameter> parameters;
     };
 
     enum class parameter_type_mode
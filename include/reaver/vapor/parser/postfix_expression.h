@@ -40,9 +40,9 @@ inline namespace _v1
     struct postfix_expression
     {
         range_type range;
-        std::variant<identifier, recursive_wrapper<expression_list>> base_expression = identifier();
+        std::variant<identifier, node_ptr<expression_list>> base_expression = identifier();
         std::optional<lexer::token_type> modifier_type = std::nullopt;
-        std::vector<expression> arguments = {};
+        node_list<expression> arguments = {};
         std::optional<identifier> accessed_member = std::nullopt;
     };
 
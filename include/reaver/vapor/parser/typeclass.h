@@ -36,7 +36,7 @@ inline namespace _v1
     {
         range_type range;
         parameter_list parameters;
-        std::vector<std::variant<function_declaration, function_definition>> members;
+        node_list<std::variant<function_declaration, function_definition>> members;
     };
 
     struct instance_literal
@@ -44,7 +44,7 @@ inline namespace _v1
         range_type range;
         id_expression typeclass_name;
         expression_list arguments;
-        std::vector<std::variant<function_definition>> definitions;
+        node_list<std::variant<function_definition>> definitions;
     };
 
     struct default_instance_definition
@@ -25,6 +25,7 @@
 #include "../lexer/token.h"
 #include "../range.h"
 #include "expression.h"
+#include "operators.h"
 
 namespace reaver::vapor::parser
 {
@@ -51,14 +52,8 @@ inline namespace _v1
         return lhs.range == rhs.range && lhs.op == rhs.op && lhs.operand == rhs.operand;
     }
 
-    const std::vector<lexer::token_type> & unary_operators();
-
-    inline bool is_unary_operator(lexer::token_type t)
-    {
-        return std::find(unary_operators().begin(), unary_operators().end(), t) != unary_operators().end();
-    }
-
-    unary_expression parse_unary_expression(context & ctx);
+    unary_expression parse_unary_expression(context & ctx,
+        expression_special_modes mode = expression_special_modes::none);
 
     void print(const unary_expression & expr, std::ostream & os, print_context ctx);
 }
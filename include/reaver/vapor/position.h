@@ -22,14 +22,20 @@
 
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
 
+#include "source_manager.h"
+
 namespace reaver::vapor
 {
 inline namespace _v1
 {
+    // a byte offset into a source registered with the source manager
+    // lines and columns aren't stored; they are recovered from the source on demand, which only happens when
+    // a position is printed
     struct position
     {
         position()
@@ -40,8 +46,7 @@ inline namespace _v1
         position & operator=(const position &) = default;
         position & operator=(position &&) = default;
 
-        position(std::size_t offset, std::optional<std::string_view> file_path = std::nullopt)
-            : offset{ offset }, file_path{ file_path }
+        position(std::uint32_t offset, file_id file = 0) : offset{ offset }, file{ file }
         {
         }
 
@@ -54,7 +59,6 @@ inline namespace _v1
         position & operator+=(std::size_t len)
         {
             offset += len;
-            column += len;
             return *this;
         }
 
@@ -65,15 +69,33 @@ inline namespace _v1
             return ret;
         }
 
-        std::size_t offset = 0;
-        std::size_t line = 1;
-        std::size_t column = 1;
-        std::optional<std::string_view> file_path;
+        line_column location() const
+        {
+            return get_line_column(file, offset);
+        }
+
+        std::size_t line() const
+        {
+            return location().line;
+        }
+
+        std::size_t column() const
+        {
+            return location().column;
+        }
+
+        std::optional<std::string_view> file_path() const
+        {
+            return source_path(file);
+        }
+
+        std::uint32_t offset = 0;
+        file_id file = 0;
     };
 
     inline bool operator!=(const position & lhs, const position & rhs)
     {
-        return lhs.offset != rhs.offset || lhs.file_path != rhs.file_path;
+        return lhs.offset != rhs.offset || (lhs.file != rhs.file && lhs.file_path() != rhs.file_path());
     }
 
     inline bool operator==(const position & lhs, const position & rhs)
@@ -66,13 +66,16 @@ inline namespace _v1
 
     inline std::ostream & operator<<(std::ostream & os, const range_type & r)
     {
+        auto start = r.start().location();
+
         if (r.end() - r.start() > 1)
         {
-            return os << r.start().line << ":" << r.start().column << " (" << r.start().offset << ") - "
-                      << r.end().line << ":" << r.end().column << " (" << r.end().offset << ")";
+            auto end = r.end().location();
+            return os << start.line << ":" << start.column << " (" << r.start().offset << ") - " << end.line
+                      << ":" << end.column << " (" << r.end().offset << ")";
         }
 
-        return os << r.start().line << ":" << r.start().column << " (" << r.start().offset << ")";
+        return os << start.line << ":" << start.column << " (" << r.start().offset << ")";
     }
 }
 }
@@ -0,0 +1,58 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace reaver::vapor
+{
+inline namespace _v1
+{
+    // identifies a source registered with the source manager
+    // 0 is never handed out and stands for "no known source"
+    using file_id = std::uint32_t;
+
+    // registers a source that is already in memory
+    // `contents` must outlive any line or column query for positions in this source
+    file_id register_source(std::optional<std::string_view> path, std::string_view contents);
+
+    // registers a source on disk; it's only read if a line or a column is ever requested
+    file_id register_file(std::string path);
+
+    std::optional<std::string_view> source_path(file_id file);
+
+    struct line_column
+    {
+        std::size_t line;
+        std::size_t column;
+    };
+
+    // lines and columns are 1-based, columns count code points
+    // the line index of a source is built on the first query for it
+    // returns 0:0 for positions that don't belong to a known source
+    line_column get_line_column(file_id file, std::uint32_t offset);
+}
+}
@@ -36,9 +36,9 @@ inline namespace _v1
         return boost::locale::conv::utf_to_utf<char>(utf32);
     }
 
-    inline auto utf32(const std::string & utf8)
+    inline auto utf32(std::string_view utf8)
     {
-        return boost::locale::conv::utf_to_utf<char32_t>(utf8);
+        return boost::locale::conv::utf_to_utf<char32_t>(utf8.data(), utf8.data() + utf8.size());
     }
 }
 }
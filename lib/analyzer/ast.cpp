@@ -22,8 +22,11 @@
 
 #include "vapor/analyzer/ast.h"
 
+#include <fstream>
+
 #include <boost/iostreams/device/mapped_file.hpp>
 
+#include "vapor/analyzer/expressions/identifier.h"
 #include "vapor/parser/expr.h"
 #include "vapor/sha.h"
 
@@ -33,6 +36,44 @@ namespace reaver::vapor::analyzer
 {
 inline namespace _v1
 {
+    namespace
+    {
+        void load_source_hashes(source_hash_cache & hashes, const boost::filesystem::path & path)
+        {
+            std::ifstream file{ path.string(), std::ios::binary };
+            if (file)
+            {
+                hashes.load(file);
+            }
+        }
+
+        // the file is shared with other compilations, so merge in what they stored in the meantime,
+        // and replace it atomically
+        void store_source_hashes(source_hash_cache & hashes, const boost::filesystem::path & path)
+        {
+            load_source_hashes(hashes, path);
+
+            auto temporary =
+                path.parent_path() / boost::filesystem::unique_path(path.filename().string() + ".%%%%%%%%");
+
+            {
+                std::ofstream file{ temporary.string(), std::ios::binary };
+                if (!file)
+                {
+                    return;
+                }
+                hashes.store(file);
+            }
+
+            boost::system::error_code error;
+            boost::filesystem::rename(temporary, path, error);
+            if (error)
+            {
+                boost::filesystem::remove(temporary, error);
+            }
+        }
+    }
+
     ast::ast(parser::ast original_ast, const config::compiler_options & opts)
         : _original_ast{ std::move(original_ast) },
           _global_scope{ std::make_unique<scope>() },
@@ -42,6 +83,11 @@ inline namespace _v1
         _ctx.global_scope = _global_scope.get();
         initialize_global_scope(_global_scope.get(), _keepalive_list);
 
+        if (_source_path)
+        {
+            load_source_hashes(_ctx.source_hashes, opts.source_hash_cache_path());
+        }
+
         try
         {
             _imports = fmap(_original_ast.global_imports, [this](auto && im) {
@@ -56,6 +102,7 @@ inline namespace _v1
             }
 
             _global_scope->close();
+            resolve_identifiers(_ctx);
         }
 
         catch (exception & e)
@@ -63,6 +110,12 @@ inline namespace _v1
             default_error_engine().push(e);
         }
 
+        // all imports are done by now
+        if (_source_path)
+        {
+            store_source_hashes(_ctx.source_hashes, opts.source_hash_cache_path());
+        }
+
         default_error_engine().validate();
     }
 
@@ -76,16 +129,28 @@ inline namespace _v1
 
     void ast::simplify()
     {
-        bool cont = true;
         cached_results res;
+        res.set_evaluation_cache(&_evaluation_cache);
+        simplification_context ctx{ res };
 
-        while (cont)
+        do
         {
-            simplification_context ctx{ res };
             get(when_all(fmap(_modules, [&ctx](auto && m) { return m->simplify_module({ ctx }); })));
+        } while (ctx.next_pass());
 
-            cont = ctx.did_something_happen();
-        }
+        auto stats = res.get_statistics();
+        logger::dlog(logger::trace) << "Call result cache: " << stats.hits << " hits, " << stats.misses
+                                    << " misses, " << stats.collisions << " collisions";
+    }
+
+    void ast::load_evaluation_cache(std::istream & is)
+    {
+        _evaluation_cache.load(is);
+    }
+
+    void ast::store_evaluation_cache(std::ostream & os) const
+    {
+        _evaluation_cache.store(os);
     }
 
     std::vector<codegen::ir::entity> ast::codegen_ir() const
@@ -125,6 +190,7 @@ inline namespace _v1
     void ast::serialize_to(std::ostream & os) const
     {
         proto::ast serialized;
+        serialized.set_format_version(interface_format_version);
 
         auto info = std::make_unique<proto::compilation_information>();
 
@@ -137,9 +203,16 @@ inline namespace _v1
 
         serialized.set_allocated_compilation_info(info.release());
 
-        std::unordered_set<entity *> import_deps;
+        // kept in discovery order rather than pointer order, so the interface file is the same on every run
+        std::unordered_set<entity *> seen_deps;
+        std::vector<entity *> import_deps;
         auto add_import = [&](auto && self, entity * module) -> void {
-            import_deps.insert(module);
+            if (!seen_deps.insert(module).second)
+            {
+                return;
+            }
+
+            import_deps.push_back(module);
             for (auto && import_dep : module->get_import_dependencies())
             {
                 self(self, import_dep);
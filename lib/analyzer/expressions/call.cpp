@@ -288,8 +288,8 @@ inline namespace _v1
                     if (repl_fn)
                     {
                         _function = repl_fn;
-                        _vtable_arg.reset();
-                        ctx.proper.something_happened();
+                        ctx.proper.something_happened(this);
+                        ctx.proper.keep_alive(_vtable_arg.release());
                     }
                 }
 
@@ -302,7 +302,7 @@ inline namespace _v1
                     if (repl[i] && repl[i] != _args[i])
                     {
                         _args[i] = repl[i];
-                        ctx.proper.something_happened();
+                        ctx.proper.something_happened(this);
                     }
                 }
 
@@ -365,7 +365,9 @@ inline namespace _v1
             auto call_operand = codegen::ir::instruction{ std::nullopt,
                 std::nullopt,
                 { boost::typeindex::type_id<codegen::ir::member_access_instruction>() },
-                { vtable, codegen::ir::integer_value{ _function->vtable_slot().value() } },
+                { vtable,
+                    codegen::ir::integer_value{
+                        interned_integer{ static_cast<int128>(_function->vtable_slot().value()) } } },
                 { codegen::ir::make_variable(
                     codegen::ir::builtin_types().function(get_type()->codegen_type(ctx),
                         fmap(_args, [&](auto && arg) { return arg->get_type()->codegen_type(ctx); }))) } };
@@ -21,6 +21,9 @@
  **/
 
 #include "vapor/analyzer/expressions/entity.h"
+
+#include <algorithm>
+
 #include "vapor/analyzer/expressions/overload_set.h"
 #include "vapor/analyzer/expressions/runtime_value.h"
 #include "vapor/analyzer/expressions/typeclass.h"
@@ -140,11 +143,18 @@ inline namespace _v1
     std::vector<codegen::ir::entity> entity::module_codegen_ir(ir_generation_context & ctx) const
     {
         assert(_owned);
-        assert(dynamic_cast<module_type *>(_owned.value().get()));
+        assert(isa<module_type>(_owned.value().get()));
 
         auto scopes = _owned.value()->get_scope()->codegen_ir();
 
-        auto mod = mbind(_owned.value()->get_scope()->symbols_in_order(), [&](auto && symbol) {
+        // imported entities that were never looked up don't need to be declared
+        std::vector<symbol *> symbols;
+        std::copy_if(_owned.value()->get_scope()->symbols_in_order().begin(),
+            _owned.value()->get_scope()->symbols_in_order().end(),
+            std::back_inserter(symbols),
+            [](auto && symbol) { return symbol->is_materialized(); });
+
+        auto mod = mbind(symbols, [&](auto && symbol) {
             return fmap(symbol->codegen_ir(ctx), [&](auto && decl) {
                 return fmap(decl,
                     make_overload_set(
@@ -149,14 +149,11 @@ inline namespace _v1
                 [&uptr, ctx, self](auto && simpl) -> future<expression *> {
                     replace_uptr(uptr, simpl, *ctx);
 
-                    if (uptr->is_constant() || !ctx->did_something_happen())
+                    if (uptr->is_constant() || !ctx->next_pass())
                     {
                         return make_ready_future<expression *>(uptr.get());
                     }
 
-                    auto & res = ctx->results;
-                    ctx->~simplification_context();
-                    new (&*ctx) simplification_context(res);
                     return self(self);
                 });
         };
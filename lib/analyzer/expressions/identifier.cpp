@@ -21,17 +21,51 @@
  **/
 
 #include "vapor/analyzer/expressions/identifier.h"
+#include "vapor/analyzer/precontext.h"
 #include "vapor/parser.h"
 
 namespace reaver::vapor::analyzer
 {
 inline namespace _v1
 {
+    std::unique_ptr<identifier> preanalyze_identifier(precontext & ctx,
+        const parser::identifier & parse,
+        scope * lex_scope)
+    {
+        auto ret = std::make_unique<identifier>(parse.value.name, lex_scope, make_node(parse));
+        // late preanalysis runs on analysis threads, so the identifiers it creates aren't registered; they
+        // are bound by their own analysis instead
+        if (!ctx.identifiers_resolved)
+        {
+            ctx.identifiers.push_back(ret.get());
+        }
+        return ret;
+    }
+
+    void resolve_identifiers(precontext & ctx)
+    {
+        for (auto && id : ctx.identifiers)
+        {
+            id->resolve();
+        }
+
+        ctx.identifiers.clear();
+        ctx.identifiers_resolved = true;
+    }
+
+    void identifier::resolve()
+    {
+        if (!_symbol)
+        {
+            _symbol = _lex_scope->resolve(_name);
+        }
+    }
+
     void identifier::print(std::ostream & os, print_context ctx) const
     {
         os << styles::def << ctx << styles::rule_name << "identifier";
         print_address_range(os, this);
-        os << ' ' << styles::string_value << utf8(_name) << '\n';
+        os << ' ' << styles::string_value << _name.utf8() << '\n';
 
         auto expr_ctx = ctx.make_branch(!try_get_type());
         os << styles::def << expr_ctx << styles::subrule_name << "referenced expression";
@@ -47,8 +81,10 @@ inline namespace _v1
 
     future<> identifier::_analyze(analysis_context & ctx)
     {
-        return _lex_scope->resolve(_name)
-            ->get_expression_future()
+        // identifiers from late preanalysis (typeclass instance members) are bound here
+        resolve();
+
+        return _symbol->get_expression_future()
             .then([&, this](auto && expression) {
                 _referenced = expression;
                 return _referenced->analyze(ctx);
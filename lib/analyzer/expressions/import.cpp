@@ -20,7 +20,8 @@
  *
  **/
 
-#include <numeric>
+#include <algorithm>
+#include <limits>
 
 #include <boost/algorithm/string/join.hpp>
 #include <boost/iostreams/device/mapped_file.hpp>
@@ -33,79 +34,19 @@
 #include "vapor/analyzer/types/unresolved.h"
 #include "vapor/codegen/ir/scope.h"
 #include "vapor/parser/import_expression.h"
-#include "vapor/sha.h"
 
 #include "ast.pb.h"
+#include "entity.pb.h"
 
 namespace reaver::vapor::analyzer
 {
 inline namespace _v1
 {
-    template<typename Iter>
-    std::optional<boost::filesystem::path> find_module(const boost::filesystem::path & module_path,
-        Iter begin,
-        Iter & end,
-        bool source_only = false)
-    {
-        auto actual_path = std::accumulate(begin, end, module_path, std::divides<>());
-
-        // inside a module directory that matches...
-        if (boost::filesystem::is_directory(actual_path))
-        {
-            // if there is a compiled module and we are looking for more than just sources, return that
-            if (!source_only && boost::filesystem::is_regular_file(actual_path / "module.vprm"))
-            {
-                return std::make_optional(actual_path / "module.vprm");
-            }
-
-            // else if there is a module source, return that
-            if (boost::filesystem::is_regular_file(actual_path / "module.vpr"))
-            {
-                return std::make_optional(actual_path / "module.vpr");
-            }
-
-            // but if the directory exists, but there's no "module" file inside, throw an error
-            // TODO: make this throw and not assert...
-            assert(!"found a module directory, but no master module file inside...");
-        }
-
-        // if there is a non-directory compiled module that matches and we are interested in more than
-        // sources...
-        if (!source_only && boost::filesystem::is_regular_file(actual_path.replace_extension(".vprm")))
-        {
-            return std::make_optional(actual_path);
-        }
-
-        // else if there's a non-directory module source, return that
-        if (boost::filesystem::is_regular_file(actual_path.replace_extension(".vpr")))
-        {
-            return std::make_optional(actual_path);
-        }
-
-        // otherwise, if there's a parent, try to find its parent somehow, maybe it defines the submodule
-        if (begin != end - 1)
-        {
-            return find_module(module_path, begin, --end, source_only);
-        }
-
-        return std::nullopt;
-    }
-
     std::optional<boost::filesystem::path> find_module(precontext & ctx,
         const std::vector<std::string> & module_name,
         bool source_only = false)
     {
-        for (auto module_path : ctx.options.module_paths())
-        {
-            auto end = module_name.end();
-
-            if (auto found_module = find_module(module_path, module_name.begin(), end, source_only))
-            {
-                return found_module;
-            }
-        }
-
-        return std::nullopt;
+        return ctx.locator.find(ctx.options.module_paths(), module_name, source_only);
     }
 
     entity * import_module(precontext & ctx, const std::vector<std::string> & module_name);
@@ -114,16 +55,29 @@ inline namespace _v1
         const boost::filesystem::path & path,
         const std::vector<std::string> & module_name)
     {
-        std::ifstream interface_file{ path.string() };
-        if (!interface_file)
+        boost::iostreams::mapped_file_source interface_file;
+        try
+        {
+            interface_file.open(path.string());
+        }
+        catch (std::exception &)
         {
             throw exception{ logger::fatal } << "couldn't open module interface file: " << path;
         }
 
-        auto ast = std::make_shared<proto::ast>();
-        ctx.imported_asts.push_back(ast);
+        // the serialized form is a lower bound of the size of the parsed ast; starting with blocks this large
+        // keeps the number of allocations done while parsing small
+        google::protobuf::ArenaOptions arena_options;
+        arena_options.start_block_size = std::max(arena_options.start_block_size, 2 * interface_file.size());
+        arena_options.max_block_size = std::max(arena_options.max_block_size, arena_options.start_block_size);
+
+        // importing the dependencies below adds more arenas, so only the arena itself is stable
+        auto arena =
+            ctx.import_arenas.emplace_back(std::make_unique<google::protobuf::Arena>(arena_options)).get();
+        auto ast = google::protobuf::Arena::CreateMessage<proto::ast>(arena);
 
-        if (!ast->ParseFromIstream(&interface_file))
+        if (interface_file.size() > static_cast<std::size_t>(std::numeric_limits<int>::max())
+            || !ast->ParseFromArray(interface_file.data(), static_cast<int>(interface_file.size())))
         {
             throw exception{ logger::fatal }
                 << "couldn't parse the serialized ast from the module interface file " << path;
@@ -139,24 +93,19 @@ inline namespace _v1
             auto check_module = [&ctx](auto && comp_time, auto && comp_hash, auto && module_name) {
                 if (auto source_path = find_module(ctx, module_name, true))
                 {
-                    if (static_cast<std::int64_t>(boost::filesystem::last_write_time(source_path.value()))
-                        > comp_time)
+                    if (ctx.source_hashes.last_write_time(source_path.value()) > comp_time
+                        && ctx.source_hashes.hash(source_path.value()) != comp_hash)
                     {
-                        boost::iostreams::mapped_file_source source{ source_path->string() };
-                        auto sha256sum = sha256(source.data(), source.size());
-
-                        if (sha256sum != comp_hash)
-                        {
-                            return false;
-                        }
+                        return false;
                     }
                 }
 
                 return true;
             };
 
-            bool is_up_to_date = check_module(
-                ast->compilation_info().time(), ast->compilation_info().source_hash(), module_name);
+            bool is_up_to_date = is_supported_interface(*ast)
+                && check_module(
+                    ast->compilation_info().time(), ast->compilation_info().source_hash(), module_name);
 
             if (is_up_to_date)
             {
@@ -174,14 +123,28 @@ inline namespace _v1
 
             if (!is_up_to_date)
             {
+                // nothing refers to the stale ast, so its arena can go before the module is recompiled
+                assert(ctx.import_arenas.back().get() == arena);
+                ctx.import_arenas.pop_back();
+                interface_file.close();
+
                 ctx.options.compile_file(source_path.value());
+                // the compilation has written a new module interface file
+                ctx.locator.invalidate();
                 import_module(ctx, module_name);
                 return;
             }
         }
 
+        if (!is_supported_interface(*ast))
+        {
+            throw exception{ logger::fatal } << "unsupported format version " << ast->format_version()
+                                             << " of the module interface file " << path;
+        }
+
+        auto && source = ast->compilation_info().filepath();
         ctx.module_path_stack.push_back(
-            { boost::filesystem::canonical(path), ast->compilation_info().filepath() });
+            { boost::filesystem::canonical(path), source, register_file(source) });
 
         std::unordered_set<entity *> import_deps;
         if (ast->imports_size())
@@ -208,7 +171,6 @@ inline namespace _v1
 
             std::string cumulative_name;
 
-            module_type * type = nullptr;
             scope * lex_scope = ctx.global_scope;
 
             // TODO: integrate this with the same stuff in preanalyze_module
@@ -219,7 +181,7 @@ inline namespace _v1
 
                 if (saved)
                 {
-                    assert(dynamic_cast<module_type *>(saved->get_type()));
+                    assert(isa<module_type>(saved->get_type()));
                     lex_scope = saved->get_type()->get_scope();
 
                     continue;
@@ -230,14 +192,12 @@ inline namespace _v1
 
                 auto old_scope = std::exchange(lex_scope, scope.get());
 
-                auto type_uptr = std::make_unique<module_type>(std::move(scope), name_part);
-                type = type_uptr.get();
-
-                saved = make_entity(std::move(type_uptr));
-                auto symbol = make_symbol(utf32(name_part), saved.get());
+                saved = make_entity(std::make_unique<module_type>(std::move(scope), name_part));
+                auto interned = interned_string::from_utf8(name_part);
+                auto symbol = make_symbol(interned, saved.get());
                 symbol->hide();
                 saved->save_symbol(symbol.get());
-                assert(old_scope->init(utf32(name_part), std::move(symbol)));
+                assert(old_scope->init(interned, std::move(symbol)));
 
                 saved->set_timestamp(ast->compilation_info().time());
                 saved->set_source_hash(ast->compilation_info().source_hash());
@@ -250,28 +210,63 @@ inline namespace _v1
 
             ctx.current_lex_scope = lex_scope;
 
-            // seems that protobuf's map doesn't have a deterministic order of iteration
-            // we can't let that happen in a compiler...
-            std::vector<std::pair<const std::string *, const proto::entity *>> symbols;
-            symbols.reserve(module.symbols().size());
-            for (auto && entity : module.symbols())
+            if (!is_sorted_symbol_directory(module))
             {
-                symbols.emplace_back(&entity.first, &entity.second);
+                throw exception{ logger::fatal } << "unsorted symbol directory of module `" << name
+                                                 << "` in module file "
+                                                 << ctx.module_path_stack.back().module_file_path;
             }
-            std::sort(symbols.begin(), symbols.end(), [](auto && lhs, auto && rhs) {
-                return *lhs.first < *rhs.first;
-            });
 
-            for (auto && imported_entity : symbols)
+            // the entities are only created when a symbol is first looked up; the state of the context they
+            // need is captured here, since by then the import will have long finished
+            for (auto && entry : module.symbols())
             {
-                ctx.current_symbol = *imported_entity.first;
-                auto ent = get_entity(ctx, *imported_entity.second);
-                ent->set_name(utf32(*imported_entity.first));
-                type->add_symbol(
-                    *imported_entity.first, ent.get(), imported_entity.second->is_name_exported());
-
-                ctx.imported_entities.emplace(
-                    synthesized_udr{ ctx.module_stack.back(), ctx.current_symbol }, std::move(ent));
+                auto && name = entry.name();
+                auto interned = interned_string::from_utf8(name);
+                auto symb = make_symbol(interned);
+                if (!entry.is_name_exported())
+                {
+                    symb->hide();
+                }
+
+                // called with ctx.import_lock held, which is what makes touching the context safe here
+                auto materializer = [&ctx,
+                                        paths = ctx.module_path_stack.back(),
+                                        module = ctx.module_stack.back(),
+                                        name,
+                                        lex_scope,
+                                        arena,
+                                        entry = &entry]() -> expression * {
+                    // the imported entities keep pointers into the decoded message, so it lives in the arena
+                    auto proto_entity = google::protobuf::Arena::CreateMessage<proto::entity>(arena);
+                    if (!proto_entity->ParseFromString(entry->entity()))
+                    {
+                        throw exception{ logger::fatal } << "couldn't parse the serialized entity `" << module
+                                                         << "." << name << "` in module file "
+                                                         << paths.module_file_path;
+                    }
+
+                    ctx.module_path_stack.push_back(paths);
+                    ctx.module_stack.push_back(module);
+                    auto old_symbol = std::exchange(ctx.current_symbol, name);
+                    auto old_scope = std::exchange(ctx.current_lex_scope, lex_scope);
+
+                    auto ent = get_entity(ctx, *proto_entity);
+                    ent->set_name(utf32(name));
+                    auto ret = ent.get();
+                    ctx.imported_entities.emplace(synthesized_udr{ module, name }, std::move(ent));
+
+                    ctx.current_lex_scope = old_scope;
+                    ctx.current_symbol = std::move(old_symbol);
+                    ctx.module_stack.pop_back();
+                    ctx.module_path_stack.pop_back();
+
+                    return ret;
+                };
+                symb->set_materializer(std::move(materializer), ctx.import_lock);
+
+                ctx.imported_symbols.emplace(synthesized_udr{ ctx.module_stack.back(), name }, symb.get());
+                lex_scope->init(interned, std::move(symb));
             }
 
             ctx.module_stack.pop_back();
@@ -280,6 +275,57 @@ inline namespace _v1
         ctx.module_path_stack.pop_back();
     }
 
+    bool is_supported_interface(const proto::ast & ast)
+    {
+        return ast.format_version() == interface_format_version;
+    }
+
+    bool is_sorted_symbol_directory(const proto::module & module)
+    {
+        // names are unique, so the order has to be strict
+        return std::adjacent_find(module.symbols().begin(),
+                   module.symbols().end(),
+                   [](auto && lhs, auto && rhs) { return lhs.name() >= rhs.name(); })
+            == module.symbols().end();
+    }
+
+    const proto::symbol_entry * find_symbol_entry(const proto::module & module, std::string_view name)
+    {
+        auto it = std::lower_bound(module.symbols().begin(),
+            module.symbols().end(),
+            name,
+            [](auto && entry, auto && name) { return entry.name() < name; });
+        if (it == module.symbols().end() || it->name() != name)
+        {
+            return nullptr;
+        }
+
+        return &*it;
+    }
+
+    expression * get_imported_entity(precontext & ctx, const synthesized_udr & udr)
+    {
+        auto it = ctx.imported_symbols.find(udr);
+        if (it == ctx.imported_symbols.end())
+        {
+            logger::dlog(logger::crash) << "can't find an entity for a user defined reference " << udr.module
+                                        << "." << udr.name << styles::def;
+            logger::default_logger().sync();
+            assert(0);
+        }
+
+        return it->second->get_expression();
+    }
+
+    std::shared_ptr<overload_set> get_imported_overload_set(precontext & ctx, const synthesized_udr & udr)
+    {
+        // importing the type of the overload set is what registers it
+        static_cast<void>(get_imported_entity(ctx, udr));
+
+        std::lock_guard<std::recursive_mutex> lock{ ctx.import_lock };
+        return ctx.imported_overload_sets[udr];
+    }
+
     entity * import_module(precontext & ctx, const std::vector<std::string> & module_name)
     {
         auto return_cached = [&]() -> entity * {
@@ -311,6 +357,7 @@ inline namespace _v1
             if (found_module->extension() == ".vpr")
             {
                 ctx.options.compile_file(found_module.value());
+                ctx.locator.invalidate();
                 return import_module(ctx, module_name);
             }
 
@@ -329,8 +376,8 @@ inline namespace _v1
         auto expr = std::get<0>(fmap(parse.module_name,
             make_overload_set(
                 [&](const parser::id_expression & expr) {
-                    auto module =
-                        fmap(expr.id_expression_value, [](auto && id) { return utf8(id.value.string); });
+                    auto module = fmap(
+                        expr.id_expression_value, [](auto && id) { return std::string{ id.value.string }; });
                     auto ent = import_module(ctx, module);
                     assert(ent);
 
@@ -32,9 +32,9 @@ inline namespace _v1
 {
     std::unique_ptr<expression> integer_constant::convert_to(type * target) const
     {
-        if (auto sized_target = dynamic_cast<sized_integer *>(target))
+        if (auto sized_target = dyn_cast<sized_integer>(target))
         {
-            if (_value <= sized_target->max_value() && _value >= sized_target->min_value())
+            if (_value.get() <= sized_target->max_value() && _value.get() >= sized_target->min_value())
             {
                 return std::make_unique<sized_integer_constant>(sized_target, _value);
             }
@@ -34,7 +34,7 @@ inline namespace _v1
         const parser::member_expression & parse,
         scope *)
     {
-        return std::make_unique<member_access_expression>(make_node(parse), parse.member_name.value.string);
+        return std::make_unique<member_access_expression>(make_node(parse), parse.member_name.value.name);
     }
 
     void member_access_expression::print(std::ostream & os, print_context ctx) const
@@ -48,7 +48,7 @@ inline namespace _v1
         {
             os << styles::def << " @ " << styles::address << this << styles::def << ": ";
         }
-        os << styles::string_value << ' ' << utf8(_name) << '\n';
+        os << styles::string_value << ' ' << _name.utf8() << '\n';
 
         auto type_ctx = ctx.make_branch(true);
         os << styles::def << type_ctx << styles::subrule_name << "referenced member type:\n";
@@ -22,6 +22,8 @@
 
 #include "vapor/analyzer/expressions/module.h"
 
+#include <map>
+
 #include <reaver/future_get.h>
 #include <reaver/prelude/monad.h>
 #include <reaver/traits.h>
@@ -48,7 +50,7 @@ inline namespace _v1
 
         // TODO: integrate this with the same stuff in import_from_ast
         auto name = fmap(parse.name.id_expression_value, [&](auto && elem) {
-            auto name_part = elem.value.string;
+            auto name_part = utf32(elem.value.string);
 
             cumulative_name = cumulative_name + (cumulative_name.empty() ? "" : ".") + utf8(name_part);
             auto & saved = ctx.modules[cumulative_name];
@@ -71,7 +73,7 @@ inline namespace _v1
 
             else
             {
-                assert(dynamic_cast<module_type *>(saved->get_type()));
+                assert(isa<module_type>(saved->get_type()));
                 lex_scope = saved->get_type()->get_scope();
             }
 
@@ -181,6 +183,27 @@ inline namespace _v1
         return mod;
     }
 
+    namespace
+    {
+        proto::symbol_entry::kind entity_kind(const proto::entity & ent)
+        {
+            switch (ent.value_case())
+            {
+                case proto::entity::kTypeValue:
+                    return proto::symbol_entry::kind_type;
+                case proto::entity::kOverloadSet:
+                    return proto::symbol_entry::kind_overload_set;
+                case proto::entity::kTypeclass:
+                    return proto::symbol_entry::kind_typeclass;
+                case proto::entity::kTypeclassInstance:
+                    return proto::symbol_entry::kind_typeclass_instance;
+
+                default:
+                    assert(0);
+            }
+        }
+    }
+
     void module::generate_interface(proto::module & mod) const
     {
         auto scope = _type->get_scope();
@@ -240,16 +263,31 @@ inline namespace _v1
             }
         }
 
+        // the symbol directory is sorted by name, so that importers can do binary searches on it
+        std::map<std::string, expression *> sorted_exports;
         for (auto && entity : exported_entities)
         {
-            auto & symb = mut_symbols[utf8(entity->get_entity_name())];
-            entity->generate_interface(symb);
+            sorted_exports.emplace(utf8(entity->get_entity_name()), entity);
+        }
+
+        mut_symbols.Reserve(sorted_exports.size());
+
+        for (auto && [name, entity] : sorted_exports)
+        {
+            proto::entity ent;
+            entity->generate_interface(ent);
 
             auto it = named_exports.find(entity);
             if (it != named_exports.end())
             {
-                symb.set_is_name_exported(true);
+                ent.set_is_name_exported(true);
             }
+
+            auto & symb = *mut_symbols.Add();
+            symb.set_name(name);
+            symb.set_entity_kind(entity_kind(ent));
+            symb.set_is_name_exported(ent.is_name_exported());
+            ent.SerializeToString(symb.mutable_entity());
         }
     }
 }
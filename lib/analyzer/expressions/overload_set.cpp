@@ -27,6 +27,7 @@
 #include <boost/algorithm/string/join.hpp>
 
 #include "vapor/analyzer/expressions/expression_ref.h"
+#include "vapor/analyzer/expressions/import.h"
 #include "vapor/analyzer/helpers.h"
 #include "vapor/analyzer/semantic/function.h"
 #include "vapor/analyzer/semantic/symbol.h"
@@ -55,12 +56,14 @@ inline namespace _v1
     }
 
     overload_set_expression::overload_set_expression(scope * lex_scope)
-        : _oset{ std::make_unique<overload_set>(lex_scope) }
+        : overload_set_expression_base{ kind::overload_set_expression },
+          _oset{ std::make_unique<overload_set>(lex_scope) }
     {
         _set_type(_oset->get_type());
     }
 
-    overload_set_expression::overload_set_expression(std::shared_ptr<overload_set> t) : _oset{ std::move(t) }
+    overload_set_expression::overload_set_expression(std::shared_ptr<overload_set> t)
+        : overload_set_expression_base{ kind::overload_set_expression }, _oset{ std::move(t) }
     {
         _set_type(_oset->get_type());
     }
@@ -94,7 +97,7 @@ inline namespace _v1
 
         auto type = get_type()->codegen_type(ctx);
         // TODO: figure out how to get rid of this dynamic pointer cast that is really irritating here
-        return codegen::ir::struct_value{ std::dynamic_pointer_cast<codegen::ir::user_type>(type), {} };
+        return codegen::ir::struct_value{ dyn_pointer_cast<codegen::ir::user_type>(type), {} };
     }
 
     declaration_ir overload_set_expression::declaration_codegen_ir(ir_generation_context & ctx) const
@@ -109,13 +112,14 @@ inline namespace _v1
 
     refined_overload_set_expression::refined_overload_set_expression(
         std::shared_ptr<refined_overload_set> oset)
-        : _oset{ std::move(oset) }
+        : overload_set_expression_base{ kind::refined_overload_set_expression }, _oset{ std::move(oset) }
     {
         _set_type(_oset->get_type());
     }
 
     refined_overload_set_expression::refined_overload_set_expression(overload_set * base)
-        : _oset{ std::make_unique<refined_overload_set>(base) }
+        : overload_set_expression_base{ kind::refined_overload_set_expression },
+          _oset{ std::make_unique<refined_overload_set>(base) }
     {
         _set_type(_oset->get_type());
     }
@@ -148,7 +152,7 @@ inline namespace _v1
     {
         auto type = get_type()->codegen_type(ctx);
         // TODO: figure out how to get rid of this dynamic pointer cast that is really irritating here
-        auto val = codegen::ir::struct_value{ std::dynamic_pointer_cast<codegen::ir::user_type>(type), {} };
+        auto val = codegen::ir::struct_value{ dyn_pointer_cast<codegen::ir::user_type>(type), {} };
         assert(val.type);
 
         auto overloads = get_overloads();
@@ -175,9 +179,9 @@ inline namespace _v1
     namespace _detail
     {
         template<typename F>
-        auto create_overload_set(scope * lex_scope, std::u32string name, F create)
+        auto create_overload_set(scope * lex_scope, interned_string name, F create)
         {
-            auto type_name = U"oset$" + name;
+            auto type_name = U"oset$" + name.str();
 
             auto oset = create();
             oset->set_name(name);
@@ -191,14 +195,14 @@ inline namespace _v1
         }
     }
 
-    std::unique_ptr<overload_set_expression> create_overload_set(scope * lex_scope, std::u32string name)
+    std::unique_ptr<overload_set_expression> create_overload_set(scope * lex_scope, interned_string name)
     {
         return _detail::create_overload_set(
             lex_scope, name, [&] { return std::make_unique<overload_set_expression>(lex_scope); });
     }
 
     std::unique_ptr<refined_overload_set_expression> create_refined_overload_set(scope * lex_scope,
-        std::u32string name,
+        interned_string name,
         overload_set * base)
     {
         return _detail::create_overload_set(
@@ -208,7 +212,7 @@ inline namespace _v1
     namespace _detail
     {
         template<typename F, typename G>
-        auto get_overload_set(scope * lex_scope, std::u32string name, F create, G clone)
+        auto get_overload_set(scope * lex_scope, interned_string name, F create, G clone)
         {
             auto symbol = lex_scope->try_get(name);
 
@@ -239,7 +243,7 @@ inline namespace _v1
         }
     }
 
-    std::unique_ptr<overload_set_expression_base> get_overload_set(scope * lex_scope, std::u32string name)
+    std::unique_ptr<overload_set_expression_base> get_overload_set(scope * lex_scope, interned_string name)
     {
         return _detail::get_overload_set(
             lex_scope,
@@ -248,7 +252,7 @@ inline namespace _v1
                 return create_overload_set(lex_scope, name);
             },
             [](expression * expr) -> std::unique_ptr<overload_set_expression_base> {
-                // this will dynamic_cast twice, but until this proves problematic, it seems fine
+                // this will check the kind twice, but that's just a comparison
                 if (expr->as<overload_set_expression>())
                 {
                     return _detail::clone_oset_expr(expr);
@@ -257,14 +261,14 @@ inline namespace _v1
             });
     }
 
-    std::unique_ptr<overload_set_expression> get_overload_set_special(scope * lex_scope, std::u32string name)
+    std::unique_ptr<overload_set_expression> get_overload_set_special(scope * lex_scope, interned_string name)
     {
         return _detail::get_overload_set(
             lex_scope, name, [&] { return create_overload_set(lex_scope, name); }, _detail::clone_oset_expr);
     }
 
     std::unique_ptr<refined_overload_set_expression> get_refined_overload_set(scope * lex_scope,
-        std::u32string name,
+        interned_string name,
         overload_set * base)
     {
         return _detail::get_overload_set(
@@ -282,7 +286,7 @@ inline namespace _v1
 
     future<> unresolved_overload_set_expression::_analyze(analysis_context &)
     {
-        auto && oset = _ctx->imported_overload_sets[_udr];
+        auto oset = get_imported_overload_set(*_ctx, _udr);
         assert(oset);
         _resolved = std::make_unique<overload_set_expression>(oset);
         _set_type(oset->get_type());
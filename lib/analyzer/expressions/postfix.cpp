@@ -51,18 +51,19 @@ inline namespace _v1
                     }))),
             parse.modifier_type,
             fmap(parse.arguments, [&](auto && expr) { return preanalyze_expression(ctx, expr, lex_scope); }),
-            fmap(parse.accessed_member, [&](auto && member) { return member.value.string; }));
+            fmap(parse.accessed_member, [&](auto && member) { return member.value.name; }));
     }
 
     postfix_expression::postfix_expression(ast_node parse,
         std::unique_ptr<expression> base,
         std::optional<lexer::token_type> mod,
         std::vector<std::unique_ptr<expression>> arguments,
-        std::optional<std::u32string> accessed_member)
-        : _base_expr{ std::move(base) },
+        std::optional<interned_string> accessed_member)
+        : expression{ kind::postfix_expression },
+          _base_expr{ std::move(base) },
           _modifier{ mod },
           _arguments{ std::move(arguments) },
-          _accessed_member{ std::move(accessed_member) }
+          _accessed_member{ accessed_member }
     {
         _set_ast_info(parse);
     }
@@ -87,7 +88,7 @@ inline namespace _v1
             {
                 auto referenced_ctx = ctx.make_branch(true);
                 os << styles::def << referenced_ctx << styles::subrule_name
-                   << "referenced member: " << styles::string_value << utf8(*_accessed_member) << '\n';
+                   << "referenced member: " << styles::string_value << _accessed_member->utf8() << '\n';
                 return;
             }
 
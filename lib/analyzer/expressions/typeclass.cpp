@@ -43,7 +43,7 @@ inline namespace _v1
     }
 
     typeclass_expression::typeclass_expression(ast_node parse, std::unique_ptr<typeclass> tc)
-        : _typeclass{ std::move(tc) }
+        : expression{ kind::typeclass_expression }, _typeclass{ std::move(tc) }
     {
         _set_ast_info(parse);
     }
@@ -109,7 +109,7 @@ inline namespace _v1
         }
     }
 
-    expression * typeclass_instance_expression::get_member(const std::u32string & name) const
+    expression * typeclass_instance_expression::get_member(interned_string name) const
     {
         return _instance->get_scope()->get(name)->get_expression();
     }
@@ -197,7 +197,7 @@ inline namespace _v1
                                         [unresolved] { return unresolved->get_resolved(); });
                                 })))
                         .then([](class type * resolved) {
-                            auto tc_type = dynamic_cast<typeclass_instance_type *>(resolved);
+                            auto tc_type = dyn_cast<typeclass_instance_type>(resolved);
                             assert(tc_type);
                             return tc_type;
                         });
@@ -237,7 +237,7 @@ inline namespace _v1
     {
         auto type = get_type()->codegen_type(ctx);
         // TODO: figure out how to get rid of this dynamic pointer cast that is really irritating here
-        auto val = codegen::ir::struct_value{ std::dynamic_pointer_cast<codegen::ir::user_type>(type), {} };
+        auto val = codegen::ir::struct_value{ dyn_pointer_cast<codegen::ir::user_type>(type), {} };
         assert(val.type);
         val.fields.reserve(_instance->get_type()->get_overload_sets().size());
 
@@ -0,0 +1,153 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include "vapor/analyzer/module_locator.h"
+
+#include <functional>
+#include <numeric>
+
+namespace reaver::vapor::analyzer
+{
+inline namespace _v1
+{
+    std::optional<boost::filesystem::path> module_locator::find(
+        const std::vector<boost::filesystem::path> & module_paths,
+        const std::vector<std::string> & module_name,
+        bool source_only)
+    {
+        std::lock_guard<std::mutex> lock{ _lock };
+
+        for (auto && module_path : module_paths)
+        {
+            if (auto found_module = _find(module_path, module_name.begin(), module_name.end(), source_only))
+            {
+                return found_module;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    void module_locator::invalidate()
+    {
+        std::lock_guard<std::mutex> lock{ _lock };
+        _listings.clear();
+    }
+
+    std::optional<boost::filesystem::path> module_locator::_find(const boost::filesystem::path & module_path,
+        _name_iterator begin,
+        _name_iterator end,
+        bool source_only)
+    {
+        auto parent_path = std::accumulate(begin, end - 1, module_path, std::divides<>());
+        auto && name = *(end - 1);
+
+        // inside a module directory that matches...
+        if (_is_directory(parent_path, name))
+        {
+            auto actual_path = parent_path / name;
+
+            // if there is a compiled module and we are looking for more than just sources, return that
+            if (!source_only && _is_regular_file(actual_path, "module.vprm"))
+            {
+                return std::make_optional(actual_path / "module.vprm");
+            }
+
+            // else if there is a module source, return that
+            if (_is_regular_file(actual_path, "module.vpr"))
+            {
+                return std::make_optional(actual_path / "module.vpr");
+            }
+
+            // but if the directory exists, but there's no "module" file inside, throw an error
+            // TODO: make this throw and not assert...
+            assert(!"found a module directory, but no master module file inside...");
+        }
+
+        // if there is a non-directory compiled module that matches and we are interested in more than
+        // sources...
+        if (!source_only && _is_regular_file(parent_path, name + ".vprm"))
+        {
+            return std::make_optional(parent_path / (name + ".vprm"));
+        }
+
+        // else if there's a non-directory module source, return that
+        if (_is_regular_file(parent_path, name + ".vpr"))
+        {
+            return std::make_optional(parent_path / (name + ".vpr"));
+        }
+
+        // otherwise, if there's a parent, try to find its parent somehow, maybe it defines the submodule
+        if (begin != end - 1)
+        {
+            return _find(module_path, begin, end - 1, source_only);
+        }
+
+        return std::nullopt;
+    }
+
+    bool module_locator::_is_directory(const boost::filesystem::path & dir, const std::string & name)
+    {
+        auto entry = _entry(dir, name);
+        return entry && entry->value() == boost::filesystem::directory_file;
+    }
+
+    bool module_locator::_is_regular_file(const boost::filesystem::path & dir, const std::string & name)
+    {
+        auto entry = _entry(dir, name);
+        return entry && entry->value() == boost::filesystem::regular_file;
+    }
+
+    std::optional<boost::filesystem::file_type> * module_locator::_entry(const boost::filesystem::path & dir,
+        const std::string & name)
+    {
+        auto listing = _listings.find(dir.string());
+        if (listing == _listings.end())
+        {
+            listing = _listings.emplace(dir.string(), decltype(listing->second){}).first;
+
+            // a directory that can't be listed is treated as empty, like the missing entries in it
+            boost::system::error_code error;
+            for (boost::filesystem::directory_iterator it{ dir, error }, end; !error && it != end;
+                 it.increment(error))
+            {
+                listing->second.emplace(it->path().filename().string(), std::nullopt);
+            }
+        }
+
+        auto entry = listing->second.find(name);
+        if (entry == listing->second.end())
+        {
+            return nullptr;
+        }
+
+        // follows symlinks, the same way the module files are opened later
+        if (!entry->second)
+        {
+            boost::system::error_code error;
+            entry->second = boost::filesystem::status(dir / name, error).type();
+        }
+
+        return &entry->second;
+    }
+}
+}
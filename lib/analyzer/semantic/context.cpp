@@ -39,7 +39,7 @@ inline namespace _v1
         boost::hash_combine(seed, arg_list.size());
         for (auto && arg : arg_list)
         {
-            boost::hash_combine(seed, arg->hash_value());
+            boost::hash_combine(seed, *arg);
         }
 
         return seed;
@@ -73,8 +73,21 @@ inline namespace _v1
         return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
     }
 
+    analysis_context::analysis_context(const analysis_context & other)
+        : results{ other.results },
+          simplification_ctx{ other.simplification_ctx },
+          entry_point_marked{ other.entry_point_marked.load() },
+          entry_variable_marked{ other.entry_variable_marked.load() }
+    {
+        std::lock_guard<std::mutex> lock{ other._types_lock };
+        _sized_integers = other._sized_integers;
+        _function_types = other._function_types;
+        _typeclass_types = other._typeclass_types;
+    }
+
     sized_integer * analysis_context::get_sized_integer_type(std::size_t size)
     {
+        std::lock_guard<std::mutex> lock{ _types_lock };
         auto & ret = _sized_integers[size];
         if (!ret)
         {
@@ -86,6 +99,7 @@ inline namespace _v1
 
     function_type * analysis_context::get_function_type(function_signature sig)
     {
+        std::lock_guard<std::mutex> lock{ _types_lock };
         auto & ret = _function_types[sig];
         if (!ret)
         {
@@ -97,6 +111,7 @@ inline namespace _v1
 
     typeclass_type * analysis_context::get_typeclass_type(std::vector<type *> param_types)
     {
+        std::lock_guard<std::mutex> lock{ _types_lock };
         auto & ret = _typeclass_types[param_types];
         if (!ret)
         {
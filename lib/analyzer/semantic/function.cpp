@@ -25,6 +25,9 @@
 #include "vapor/analyzer/semantic/symbol.h"
 #include "vapor/analyzer/statements/block.h"
 #include "vapor/analyzer/statements/return.h"
+#include "vapor/analyzer/vm/cache.h"
+#include "vapor/analyzer/vm/interpreter.h"
+#include "vapor/analyzer/vm/lowering.h"
 #include "vapor/parser/expr.h"
 
 namespace reaver::vapor::analyzer
@@ -47,10 +50,54 @@ inline namespace _v1
                 return make_ready_future(expr.release());
             }
 
-            if (std::find_if(ctx.call_stack.begin(),
-                    ctx.call_stack.end(),
-                    [&](auto && frame) { return frame == new_frame; })
-                != ctx.call_stack.end())
+            // calls with constant arguments are evaluated in the vm when the body can be lowered to bytecode;
+            // the clone-and-simplify path below remains for everything the vm doesn't support
+            auto bytecode = ctx.proper.results.is_failed_evaluation(new_frame) ? nullptr : vm::lower(this);
+            if (bytecode)
+            {
+                std::vector<vm::value> values;
+                for (auto && arg : arguments)
+                {
+                    auto val = vm::to_value(arg);
+                    if (!val)
+                    {
+                        break;
+                    }
+                    values.push_back(std::move(val.value()));
+                }
+
+                if (values.size() == arguments.size())
+                {
+                    auto cache = ctx.proper.results.get_evaluation_cache();
+                    auto result = cache ? cache->get(*bytecode, values) : std::nullopt;
+                    if (!result)
+                    {
+                        result = vm::run(*bytecode, values, {}, &ctx.proper.results.get_vm_profile());
+                        if (result && cache)
+                        {
+                            cache->save(*bytecode, std::move(values), result.value());
+                        }
+                    }
+
+                    auto expr = result
+                        ? vm::to_expression(
+                              result.value(), return_type_expression()->as<type_expression>()->get_value())
+                        : nullptr;
+
+                    if (expr)
+                    {
+                        replacements repl;
+                        ctx.proper.results.save_call_result(new_frame, repl.claim(expr.get()));
+                        return make_ready_future(expr.release());
+                    }
+
+                    // a division by zero or running out of the evaluation budget; the vm isn't asked again,
+                    // and the clone path below gets to try, since it isn't bound by the same limits
+                    ctx.proper.results.save_failed_evaluation(new_frame);
+                }
+            }
+
+            if (ctx.call_stack.contains(new_frame))
             {
                 return make_ready_future<expression *>(nullptr);
             }
@@ -68,20 +115,14 @@ inline namespace _v1
                                             ctx = recursive_context{ *proper_ctx, ctx.call_stack }](
                                             auto self, auto body) {
                             auto new_ctx = ctx;
-                            new_ctx.call_stack.push_back({ this, arguments });
+                            new_ctx.call_stack = new_ctx.call_stack.push({ this, arguments });
                             return body->simplify(new_ctx).then([proper_ctx, old_body = body, new_ctx, self](
                                                                     auto && body) -> future<statement *> {
-                                if (!new_ctx.proper.did_something_happen())
+                                if (!proper_ctx->next_pass())
                                 {
                                     return make_ready_future(body);
                                 }
 
-                                // ugh
-                                // but I don't know how else to write this
-                                // without creating a long overload for optctx
-                                auto & res = proper_ctx->results;
-                                proper_ctx->~simplification_context();
-                                new (&*proper_ctx) simplification_context(res);
                                 return self(self, body);
                             });
                         };
@@ -96,7 +137,7 @@ inline namespace _v1
                     .then([=](auto && body) {
                         auto returns = body->get_returns();
 
-                        auto body_block = dynamic_cast<block *>(body);
+                        auto body_block = dyn_cast<block>(body);
                         auto has_return_expr = body_block && body_block->has_return_expression();
                         assert(has_return_expr || returns.size());
 
@@ -143,7 +143,7 @@ inline namespace _v1
                 {
                     logger::dlog() << overload->explain()
                                    << " not considered; mismatch in member assignment arguments; ."
-                                   << utf8(arg->member_name()) << " did not match any members";
+                                   << arg->member_name().utf8() << " did not match any members";
                     return false;
                 }
 
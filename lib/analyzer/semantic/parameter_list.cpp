@@ -59,19 +59,19 @@ inline namespace _v1
                 assert(!"a type not provided outside of an instance context");
             }();
 
-            auto param = std::make_unique<parameter>(
-                make_node(param_parse), param_parse.name.value.string, std::move(type));
+            auto name = param_parse.name.value.name;
+            auto param = std::make_unique<parameter>(make_node(param_parse), name, std::move(type));
 
-            auto symb = make_symbol(param_parse.name.value.string, param.get());
-            lex_scope->init(param_parse.name.value.string, std::move(symb));
+            auto symb = make_symbol(name, param.get());
+            lex_scope->init(name, std::move(symb));
 
             ++i;
             return param;
         });
     }
 
-    parameter::parameter(ast_node parse, std::u32string name, std::unique_ptr<expression> type)
-        : _name{ std::move(name) }, _type_expression{ std::move(type) }
+    parameter::parameter(ast_node parse, interned_string name, std::unique_ptr<expression> type)
+        : expression{ kind::parameter }, _name{ name }, _type_expression{ std::move(type) }
     {
         _set_ast_info(parse);
     }
@@ -82,7 +82,7 @@ inline namespace _v1
     {
         os << styles::def << ctx << styles::rule_name << "parameter";
         print_address_range(os, this);
-        os << ' ' << styles::string_value << utf8(_name) << '\n';
+        os << ' ' << styles::string_value << _name.utf8() << '\n';
 
         auto type_expr_ctx = ctx.make_branch(true);
         os << styles::def << type_expr_ctx << styles::subrule_name << "type expression:\n";
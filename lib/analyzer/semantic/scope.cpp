@@ -22,6 +22,8 @@
 
 #include "vapor/analyzer/semantic/scope.h"
 
+#include <algorithm>
+
 #include <reaver/future_get.h>
 
 #include "vapor/analyzer/expressions/call.h"
@@ -37,7 +39,12 @@ namespace reaver::vapor::analyzer
 {
 inline namespace _v1
 {
-    std::unordered_set<std::u32string> reserved_identifiers = { U"type", U"bool", U"int", U"sized_int" };
+    std::unordered_set<interned_string> reserved_identifiers = { U"type", U"bool", U"int", U"sized_int" };
+
+    namespace
+    {
+        const auto symbol_name_less = [](auto && entry, auto && name) { return entry.first < name; };
+    }
 
     scope::~scope()
     {
@@ -59,7 +66,7 @@ inline namespace _v1
         }
     }
 
-    symbol * scope::init(const std::u32string & name, std::unique_ptr<symbol> symb)
+    symbol * scope::init(interned_string name, std::unique_ptr<symbol> symb)
     {
         if (reserved_identifiers.count(name) && _global != this)
         {
@@ -72,7 +79,7 @@ inline namespace _v1
 
         for (auto scope = this; scope; scope = scope->_parent)
         {
-            if (scope->_symbols.find(name) != scope->_symbols.end())
+            if (scope->_find(name))
             {
                 return nullptr;
             }
@@ -83,59 +90,61 @@ inline namespace _v1
             }
         }
 
-        _symbols_in_order.push_back(symb.get());
-        return _symbols.emplace(name, std::move(symb)).first->second.get();
+        return _insert(name, std::move(symb));
     }
 
-    symbol * scope::get(const std::u32string & name) const
+    symbol * scope::_find(interned_string name) const
     {
-        auto symb = try_get(name);
-        if (!symb)
+        auto it = std::lower_bound(_symbols.begin(), _symbols.end(), name, symbol_name_less);
+        if (it == _symbols.end() || it->first != name)
         {
-            throw failed_lookup{ name };
+            return nullptr;
         }
-        return symb.value();
+
+        return it->second.get();
     }
 
-    std::optional<symbol *> scope::try_get(const std::u32string & name) const
+    symbol * scope::_insert(interned_string name, std::unique_ptr<symbol> symb)
     {
-        auto it = _symbols.find(name);
-        if (it == _symbols.end() || it->second->is_hidden())
-        {
-            return std::nullopt;
-        }
+        auto it = std::lower_bound(_symbols.begin(), _symbols.end(), name, symbol_name_less);
+        assert(it == _symbols.end() || it->first != name);
 
-        return std::make_optional(it->second.get());
+        auto ret = symb.get();
+        _symbols.emplace(it, name, std::move(symb));
+        _symbols_in_order.push_back(ret);
+        return ret;
     }
 
-    symbol * scope::resolve(const std::u32string & name) const
+    symbol * scope::get(interned_string name) const
     {
+        auto symb = try_get(name);
+        if (!symb)
         {
-            if (reserved_identifiers.count(name))
-            {
-                return _global->get(name);
-            }
+            throw failed_lookup{ name };
         }
+        return symb.value();
+    }
 
-        auto it = _resolve_cache.find(name);
-        if (it != _resolve_cache.end())
+    std::optional<symbol *> scope::try_get(interned_string name) const
+    {
+        auto symb = _find(name);
+        if (!symb || symb->is_hidden())
         {
-            return it->second;
+            return std::nullopt;
         }
 
-        auto scope = this;
+        return std::make_optional(symb);
+    }
 
-        while (scope)
+    symbol * scope::resolve(interned_string name) const
+    {
+        // reserved identifiers can only be declared in the global scope, so the walk ends up there anyway
+        for (auto scope = this; scope; scope = scope->_parent)
         {
-            auto symb = scope->try_get(name);
-
-            if (symb && !symb.value()->is_hidden())
+            if (auto symb = scope->try_get(name))
             {
-                _resolve_cache.emplace(name, symb.value());
                 return symb.value();
             }
-
-            scope = scope->_parent;
         }
 
         throw failed_lookup(name);
@@ -66,7 +66,7 @@ inline namespace _v1
 
         scope_ptr->close();
 
-        std::unordered_map<std::u32string, std::size_t> overload_set_function_counts;
+        std::unordered_map<interned_string, std::size_t> overload_set_function_counts;
         for (auto && fn_decl : fn_decls)
         {
             fn_decl->get_function()->mark_virtual(overload_set_function_counts[fn_decl->get_name()]++);
@@ -85,10 +85,10 @@ inline namespace _v1
         params.reserve(tc.parameters().size());
         for (auto && param : tc.parameters())
         {
-            auto parm = std::make_unique<parameter>(imported_ast_node(ctx, param.range()),
-                utf32(param.name()),
-                get_imported_type_ref_expr(ctx, param.type()));
-            tc_scope->init(utf32(param.name()), make_symbol(utf32(param.name()), parm.get()));
+            auto name = interned_string::from_utf8(param.name());
+            auto parm = std::make_unique<parameter>(
+                imported_ast_node(ctx, param.range()), name, get_imported_type_ref_expr(ctx, param.type()));
+            tc_scope->init(name, make_symbol(name, parm.get()));
             params.push_back(std::move(parm));
         }
 
@@ -103,7 +103,8 @@ inline namespace _v1
         {
             auto oset = import_overload_set(ctx, overset.second);
             auto expr = std::make_unique<overload_set_expression>(std::move(oset));
-            tc_scope->init(utf32(overset.first), make_symbol(utf32(overset.first), expr.get()));
+            auto name = interned_string::from_utf8(overset.first);
+            tc_scope->init(name, make_symbol(name, expr.get()));
             keepalive.push_back(std::move(expr));
         }
 
@@ -213,7 +214,7 @@ inline namespace _v1
         for (auto && param : _parameters)
         {
             auto parm = ret->add_parameters();
-            parm->set_name(utf8(param->get_name()));
+            parm->set_name(param->get_name().utf8());
             parm->set_allocated_type(param->get_type()->generate_interface_reference().release());
         }
 
@@ -224,7 +225,7 @@ inline namespace _v1
             {
                 auto interface = oset->get_type()->generate_interface();
                 assert(interface->has_overload_set());
-                mut_osets[utf8(symbol->get_name())] = interface->overload_set();
+                mut_osets[symbol->get_name().utf8()] = interface->overload_set();
             }
         }
 
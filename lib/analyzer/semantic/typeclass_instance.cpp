@@ -47,7 +47,7 @@ inline namespace _v1
 
         return std::make_unique<typeclass_instance>(make_node(parse),
             std::move(scope),
-            fmap(parse.typeclass_name.id_expression_value, [&](auto && t) { return t.value.string; }),
+            fmap(parse.typeclass_name.id_expression_value, [&](auto && t) { return utf32(t.value.string); }),
             fmap(parse.arguments.expressions,
                 [&](auto && arg) { return preanalyze_expression(ctx, arg, scope_ptr); }));
     }
@@ -204,7 +204,7 @@ inline namespace _v1
 
             auto body_stmt = repl.copy_claim(it->second);
 
-            auto body_block = dynamic_cast<block *>(body_stmt.get());
+            auto body_block = dyn_cast<block>(body_stmt.get());
             assert(body_block);
             fn_spec.function_body.reset(body_block);
             body_stmt.release();
@@ -22,11 +22,16 @@
 
 #include "vapor/analyzer/simplification/context.h"
 
+#include <algorithm>
+#include <bitset>
+#include <limits>
+
 #include <boost/functional/hash.hpp>
 
 #include "vapor/analyzer/expressions/expression.h"
 #include "vapor/analyzer/semantic/function.h"
 #include "vapor/analyzer/semantic/symbol.h"
+#include "vapor/analyzer/vm/interpreter.h"
 
 std::size_t std::hash<reaver::vapor::analyzer::call_frame>::operator()(
     const reaver::vapor::analyzer::call_frame & frame) const
@@ -35,9 +40,12 @@ std::size_t std::hash<reaver::vapor::analyzer::call_frame>::operator()(
 
     boost::hash_combine(seed, frame.function);
     boost::hash_combine(seed, frame.arguments.size());
-    for (auto && arg : frame.arguments)
+
+    // must agree with operator==, which skips the object argument of members
+    // and considers all non-constant arguments equal
+    for (auto it = frame.arguments.begin() + frame.function->is_member(); it != frame.arguments.end(); ++it)
     {
-        boost::hash_combine(seed, *arg);
+        boost::hash_combine(seed, (*it)->is_constant() ? hash_value(**it) : 0);
     }
 
     return seed;
@@ -59,8 +67,125 @@ inline namespace _v1
             == lhs.arguments.end();
     }
 
+    // leaves hold the frames with one hash; inner nodes hold up to 32 children, indexed by the next five
+    // bits of the hash, with only the present ones stored, in the order of their indices
+    struct call_stack::_set_node
+    {
+        bool is_leaf;
+        std::size_t hash;
+        std::vector<const call_frame *> frames;
+
+        std::uint32_t bitmap;
+        std::vector<std::shared_ptr<const _set_node>> children;
+    };
+
+    namespace
+    {
+        constexpr std::size_t set_bits = 5;
+        constexpr std::size_t hash_bits = std::numeric_limits<std::size_t>::digits;
+
+        std::uint32_t set_bit(std::size_t hash, std::size_t shift)
+        {
+            return std::uint32_t(1) << ((hash >> shift) & ((1 << set_bits) - 1));
+        }
+
+        std::size_t set_position(std::uint32_t bitmap, std::uint32_t bit)
+        {
+            return std::bitset<32>(bitmap & (bit - 1)).count();
+        }
+    }
+
+    // copies only the path from the root to the changed leaf; everything else is shared with `node`
+    std::shared_ptr<const call_stack::_set_node> call_stack::_insert(
+        const std::shared_ptr<const _set_node> & node,
+        std::size_t hash,
+        const call_frame * frame,
+        std::size_t shift)
+    {
+        if (!node)
+        {
+            return std::make_shared<const _set_node>(_set_node{ true, hash, { frame }, 0, {} });
+        }
+
+        if (node->is_leaf)
+        {
+            if (node->hash == hash)
+            {
+                auto ret = std::make_shared<_set_node>(*node);
+                ret->frames.push_back(frame);
+                return ret;
+            }
+
+            // different hashes always differ in some bits that aren't consumed yet
+            assert(shift < hash_bits);
+            auto inner = std::make_shared<const _set_node>(
+                _set_node{ false, 0, {}, set_bit(node->hash, shift), { node } });
+            return _insert(inner, hash, frame, shift);
+        }
+
+        auto bit = set_bit(hash, shift);
+        auto position = set_position(node->bitmap, bit);
+
+        auto ret = std::make_shared<_set_node>(*node);
+        if (node->bitmap & bit)
+        {
+            ret->children[position] = _insert(node->children[position], hash, frame, shift + set_bits);
+        }
+        else
+        {
+            ret->bitmap |= bit;
+            ret->children.insert(ret->children.begin() + position, _insert(nullptr, hash, frame, 0));
+        }
+        return ret;
+    }
+
+    call_stack call_stack::push(call_frame frame) const
+    {
+        auto hash = std::hash<call_frame>()(frame);
+
+        auto node = std::make_shared<_node>(_node{ std::move(frame), depth() + 1, _top });
+        node->frames = _insert(_top ? _top->frames : nullptr, hash, &node->frame, 0);
+
+        call_stack ret;
+        ret._top = std::move(node);
+        return ret;
+    }
+
+    bool call_stack::contains(const call_frame & frame) const
+    {
+        auto hash = std::hash<call_frame>()(frame);
+
+        std::size_t shift = 0;
+        for (auto node = _top ? _top->frames.get() : nullptr; node; shift += set_bits)
+        {
+            if (node->is_leaf)
+            {
+                return node->hash == hash
+                    && std::any_of(node->frames.begin(), node->frames.end(), [&](auto && stored) {
+                           return *stored == frame;
+                       });
+            }
+
+            auto bit = set_bit(hash, shift);
+            if (!(node->bitmap & bit))
+            {
+                return false;
+            }
+            node = node->children[set_position(node->bitmap, bit)].get();
+        }
+
+        return false;
+    }
+
+    cached_results::cached_results() : _vm_profile{ std::make_unique<vm::profile>() }
+    {
+    }
+
+    cached_results::~cached_results() = default;
+
     void cached_results::save_call_result(call_frame frame, std::unique_ptr<expression> expr)
     {
+        std::unique_lock<std::shared_mutex> lock{ _lock };
         auto it = _cached_call_results.find(frame);
         if (it == _cached_call_results.end())
         {
@@ -73,15 +198,48 @@ inline namespace _v1
         }
     }
 
+    void cached_results::save_failed_evaluation(call_frame frame)
+    {
+        std::unique_lock<std::shared_mutex> lock{ _lock };
+        if (!_failed_evaluations.count(frame))
+        {
+            replacements repl;
+            auto owning =
+                fmap(frame.arguments, [&](auto && arg) { return repl.claim(arg->_get_replacement()); });
+            auto raw = fmap(owning, [](auto && arg) { return arg.get(); });
+            std::move(owning.begin(), owning.end(), std::back_inserter(_key_store));
+            _failed_evaluations.insert(call_frame{ frame.function, std::move(raw) });
+        }
+    }
+
+    bool cached_results::is_failed_evaluation(const call_frame & frame) const
+    {
+        std::shared_lock<std::shared_mutex> lock{ _lock };
+        return _failed_evaluations.count(frame);
+    }
+
     std::unique_ptr<expression> cached_results::get_call_result(call_frame frame) const
     {
+        std::shared_lock<std::shared_mutex> lock{ _lock };
         auto it = _cached_call_results.find(frame);
+
+        if (_cached_call_results.bucket_count())
+        {
+            auto in_bucket = _cached_call_results.bucket_size(_cached_call_results.bucket(frame));
+            if (in_bucket > (it != _cached_call_results.end()))
+            {
+                ++_collisions;
+            }
+        }
+
         if (it != _cached_call_results.end())
         {
+            ++_hits;
             replacements repl;
             return repl.claim(it->second.get());
         }
 
+        ++_misses;
         return {};
     }
 
@@ -106,6 +264,73 @@ inline namespace _v1
             ptr, fut.then([](auto && expr) { return static_cast<statement *>(expr); }));
     }
 
+    void simplification_context::record_use(statement * user, statement * used)
+    {
+        if (!user || user == used)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock{ _worklist_lock };
+        _users[used].insert(user);
+    }
+
+    void simplification_context::something_happened(statement * changed)
+    {
+        std::lock_guard<std::mutex> lock{ _worklist_lock };
+
+        std::vector<statement *> stack{ changed };
+        while (!stack.empty())
+        {
+            auto node = stack.back();
+            stack.pop_back();
+
+            if (!_dirty.insert(node).second)
+            {
+                continue;
+            }
+
+            auto it = _users.find(node);
+            if (it != _users.end())
+            {
+                stack.insert(stack.end(), it->second.begin(), it->second.end());
+            }
+        }
+    }
+
+    bool simplification_context::next_pass()
+    {
+        _ulock futures_lock{ _futures_lock };
+        std::lock_guard<std::mutex> lock{ _worklist_lock };
+
+        if (!_dirty.empty())
+        {
+            for (auto && node : _dirty)
+            {
+                _statement_futures.erase(node);
+                if (auto expr = dyn_cast<expression>(node))
+                {
+                    _expression_futures.erase(expr);
+                }
+            }
+
+            _dirty.clear();
+            _full_pass = false;
+            return true;
+        }
+
+        if (_full_pass)
+        {
+            return false;
+        }
+
+        _statement_futures.clear();
+        _expression_futures.clear();
+        _users.clear();
+        _full_pass = true;
+        return true;
+    }
+
     void simplification_context::keep_alive(statement * ptr)
     {
         std::lock_guard<std::mutex> lock{ _keep_alive_lock };
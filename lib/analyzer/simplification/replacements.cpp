@@ -133,12 +133,13 @@ inline namespace _v1
 
     auto replacements::_claim_special(const statement * ptr)
     {
-        if (!dynamic_cast<const expression *>(ptr))
+        auto expr = dyn_cast<expression>(ptr);
+        if (!expr)
         {
             return std::unique_ptr<expression>();
         }
 
-        auto it = _unclaimed_expressions.find(static_cast<const expression *>(ptr));
+        auto it = _unclaimed_expressions.find(expr);
         if (it != _unclaimed_expressions.end())
         {
             auto ret = std::move(it->second);
@@ -0,0 +1,140 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include "vapor/analyzer/source_hashes.h"
+
+#include <sys/stat.h>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <reaver/exception.h>
+
+#include "vapor/sha.h"
+
+#include "source_hashes.pb.h"
+
+namespace reaver::vapor::analyzer
+{
+inline namespace _v1
+{
+    std::int64_t source_hash_cache::last_write_time(const boost::filesystem::path & path)
+    {
+        std::lock_guard<std::mutex> lock{ _lock };
+        return _check(path).id.modification_time / 1'000'000'000;
+    }
+
+    std::string source_hash_cache::hash(const boost::filesystem::path & path)
+    {
+        std::lock_guard<std::mutex> lock{ _lock };
+
+        auto & entry = _check(path);
+        if (entry.hash.empty())
+        {
+            if (entry.id.size == 0)
+            {
+                entry.hash = sha256(nullptr, 0);
+            }
+
+            else
+            {
+                boost::iostreams::mapped_file_source source{ path.string() };
+                entry.hash = sha256(source.data(), source.size());
+            }
+        }
+
+        return entry.hash;
+    }
+
+    source_hash_cache::_entry & source_hash_cache::_check(const boost::filesystem::path & path)
+    {
+        auto & entry = _entries[path.string()];
+        if (entry.checked)
+        {
+            return entry;
+        }
+
+        struct stat status;
+        if (::stat(path.c_str(), &status) != 0)
+        {
+            throw exception{ logger::error } << "couldn't stat module source file " << path;
+        }
+
+        _file_id id{ static_cast<std::uint64_t>(status.st_dev),
+            static_cast<std::uint64_t>(status.st_ino),
+            static_cast<std::uint64_t>(status.st_size),
+            static_cast<std::int64_t>(status.st_mtim.tv_sec) * 1'000'000'000 + status.st_mtim.tv_nsec };
+
+        if (!(entry.id == id))
+        {
+            entry.id = id;
+            entry.hash.clear();
+        }
+
+        entry.checked = true;
+        return entry;
+    }
+
+    void source_hash_cache::load(std::istream & is)
+    {
+        proto::source_hash_cache serialized;
+        if (!serialized.ParseFromIstream(&is))
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock{ _lock };
+
+        for (auto && file : serialized.files())
+        {
+            _entries.emplace(file.path(),
+                _entry{ { file.device(), file.inode(), file.size(), file.modification_time() },
+                    file.hash(),
+                    false });
+        }
+    }
+
+    void source_hash_cache::store(std::ostream & os) const
+    {
+        proto::source_hash_cache serialized;
+
+        std::lock_guard<std::mutex> lock{ _lock };
+
+        for (auto && [path, entry] : _entries)
+        {
+            if (entry.hash.empty())
+            {
+                continue;
+            }
+
+            auto & file = *serialized.add_files();
+            file.set_path(path);
+            file.set_device(entry.id.device);
+            file.set_inode(entry.id.inode);
+            file.set_size(entry.id.size);
+            file.set_modification_time(entry.id.modification_time);
+            file.set_hash(entry.hash);
+        }
+
+        serialized.SerializeToOstream(&os);
+    }
+}
+}
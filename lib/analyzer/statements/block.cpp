@@ -78,7 +78,8 @@ inline namespace _v1
         std::vector<std::unique_ptr<statement>> statements,
         std::optional<std::unique_ptr<expression>> value_expr,
         bool is_top_level)
-        : _scope{ std::move(lex_scope) },
+        : statement{ kind::block },
+          _scope{ std::move(lex_scope) },
           _original_scope{ original_scope },
           _statements{ std::move(statements) },
           _value_expr{ std::move(value_expr) },
@@ -46,7 +46,7 @@ inline namespace _v1
         }
 
         auto ret = std::make_unique<declaration>(make_node(parse),
-            parse.identifier.value.string,
+            parse.identifier.value.name,
             fmap(parse.rhs, [&](auto && expr) { return preanalyze_expression(ctx, expr, old_scope); }),
             fmap(parse.type_expression,
                 [&](auto && expr) { return preanalyze_expression(ctx, expr, old_scope); }),
@@ -87,12 +87,13 @@ inline namespace _v1
     }
 
     declaration::declaration(ast_node parse,
-        std::u32string name,
+        interned_string name,
         std::optional<std::unique_ptr<expression>> init_expr,
         std::optional<std::unique_ptr<expression>> type_specifier,
         scope * scope,
         declaration_type decl_type)
-        : _name{ std::move(name) },
+        : statement{ kind::declaration },
+          _name{ name },
           _type_specifier{ std::move(type_specifier) },
           _init_expr{ std::move(init_expr) },
           _type{ decl_type }
@@ -116,7 +117,7 @@ inline namespace _v1
     {
         os << styles::def << ctx << styles::rule_name << "declaration";
         print_address_range(os, this);
-        os << ' ' << styles::string_value << utf8(_name) << '\n';
+        os << ' ' << styles::string_value << _name.utf8() << '\n';
 
         auto type_ctx = ctx.make_branch(!_init_expr);
         os << styles::def << type_ctx << styles::subrule_name << "type of symbol:\n";
@@ -49,7 +49,7 @@ inline namespace _v1
         auto function_scope_ptr = function_scope.get();
 
         return std::make_unique<function_declaration>(make_node(parse),
-            parse.name.value.string,
+            parse.name.value.name,
             std::move(params),
             fmap(parse.return_type,
                 [&](auto && ret_type) { return preanalyze_expression(ctx, ret_type, function_scope_ptr); }),
@@ -67,7 +67,7 @@ inline namespace _v1
         std::optional<instance_function_context> fn_ctx;
         if (instance_type)
         {
-            auto oset = instance_type->get_overload_sets().at(parse.signature.name.value.string);
+            auto oset = instance_type->get_overload_sets().at(parse.signature.name.value.name);
             auto && overloads = oset->get_overloads();
 
             auto pred = [&](auto && fn) {
@@ -116,7 +116,7 @@ inline namespace _v1
         }
 
         auto ret = std::make_unique<function_definition>(make_node(parse),
-            parse.signature.name.value.string,
+            parse.signature.name.value.name,
             std::move(params),
             std::move(ret_type),
             preanalyze_block(prectx, *parse.body, function_scope.get(), true),
@@ -124,7 +124,7 @@ inline namespace _v1
 
         if (parse.signature.export_)
         {
-            auto expr_symbol = lex_scope->get(parse.signature.name.value.string);
+            auto expr_symbol = lex_scope->get(parse.signature.name.value.name);
             expr_symbol->mark_exported();
             expr_symbol->get_expression()->mark_exported();
         }
@@ -133,19 +133,19 @@ inline namespace _v1
     }
 
     function_declaration::function_declaration(ast_node parse,
-        std::u32string name,
+        interned_string name,
         parameter_list params,
         std::optional<std::unique_ptr<expression>> return_type,
         std::unique_ptr<scope> scope)
         : _scope{ std::move(scope) },
-          _name{ std::move(name) },
+          _name{ name },
           _parameter_list{ std::move(params) },
           _return_type{ std::move(return_type) },
           _overload_set_expression{ get_overload_set(_scope->parent(), _name) }
     {
         _set_ast_info(parse);
 
-        _function = make_function(utf8(_name), get_ast_info().value().range);
+        _function = make_function(_name.utf8(), get_ast_info().value().range);
         _function->set_name(U"call");
         _function->set_scopes_generator(
             [this](auto && ctx) { return this->_overload_set_expression->get_type()->codegen_scopes(ctx); });
@@ -154,13 +154,13 @@ inline namespace _v1
     }
 
     function_definition::function_definition(ast_node parse,
-        std::u32string name,
+        interned_string name,
         parameter_list params,
         std::optional<std::unique_ptr<expression>> return_type,
         std::unique_ptr<block> body,
         std::unique_ptr<scope> scope)
         : function_declaration{ parse,
-              std::move(name),
+              name,
               std::move(params),
               std::move(return_type),
               std::move(scope) },
@@ -284,7 +284,7 @@ inline namespace _v1
     future<statement *> function_definition::_simplify(recursive_context ctx)
     {
         return _body->simplify(ctx).then([&](auto && simplified) -> statement * {
-            replace_uptr(_body, dynamic_cast<block *>(simplified), ctx.proper);
+            replace_uptr(_body, dyn_cast<block>(simplified), ctx.proper);
             return this;
         });
     }
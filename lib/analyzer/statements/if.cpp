@@ -47,7 +47,10 @@ inline namespace _v1
         std::unique_ptr<expression> condition,
         std::unique_ptr<statement> then,
         std::optional<std::unique_ptr<statement>> else_)
-        : _condition{ std::move(condition) }, _then_block{ std::move(then) }, _else_block{ std::move(else_) }
+        : statement{ kind::if_statement },
+          _condition{ std::move(condition) },
+          _then_block{ std::move(then) },
+          _else_block{ std::move(else_) }
     {
         _set_ast_info(parse);
     }
@@ -37,7 +37,7 @@ inline namespace _v1
     }
 
     return_statement::return_statement(ast_node parse, std::unique_ptr<expression> value)
-        : _value_expr{ std::move(value) }
+        : statement{ kind::return_statement }, _value_expr{ std::move(value) }
     {
         _set_ast_info(parse);
     }
@@ -30,7 +30,7 @@ namespace reaver::vapor::analyzer
 inline namespace _v1
 {
     archetype::archetype(ast_node node, const type * base, std::u32string param_name)
-        : _node{ node }, _param_name{ std::move(param_name) }, _base_type{ base }
+        : type{ kind::archetype }, _node{ node }, _param_name{ std::move(param_name) }, _base_type{ base }
     {
     }
 
@@ -46,7 +46,8 @@ inline namespace _v1
     auto boolean_type::_generate_function(const char32_t * name,
         const char * desc,
         Eval eval,
-        type * return_type)
+        type * return_type,
+        vm::intrinsic intrinsic)
     {
         auto lhs = make_runtime_value(builtin_types().boolean.get());
         auto rhs = make_runtime_value(builtin_types().boolean.get());
@@ -59,6 +60,7 @@ inline namespace _v1
         fun->set_return_type(return_type->get_expression());
         fun->set_parameters({ lhs_arg, rhs_arg });
         fun->set_eval(eval);
+        fun->set_vm_intrinsic(intrinsic);
         fun->set_intrinsic_codegen(
             [return_type, lhs = std::move(lhs), rhs = std::move(rhs)](
                 ir_generation_context & ctx, std::vector<codegen::ir::value> arguments) {
@@ -94,7 +96,11 @@ inline namespace _v1
                     .release());                                                                             \
         };                                                                                                   \
         static auto NAME = _generate_function<codegen::ir::boolean_##NAME##_instruction>(                    \
-            BUILTIN_NAME, "<builtin boolean " #NAME ">", eval, builtin_types().RESULT_TYPE.get());           \
+            BUILTIN_NAME,                                                                                    \
+            "<builtin boolean " #NAME ">",                                                                   \
+            eval,                                                                                            \
+            builtin_types().RESULT_TYPE.get(),                                                               \
+            { vm::opcode::boolean_##NAME });                                                                 \
         return NAME.get();                                                                                   \
     }
 
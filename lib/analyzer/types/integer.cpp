@@ -48,7 +48,8 @@ inline namespace _v1
     auto integer_type::_generate_function(const char32_t * name,
         const char * desc,
         Eval eval,
-        type * return_type)
+        type * return_type,
+        vm::intrinsic intrinsic)
     {
         auto lhs = make_runtime_value(builtin_types().integer.get());
         auto rhs = make_runtime_value(builtin_types().integer.get());
@@ -61,6 +62,7 @@ inline namespace _v1
         fun->set_return_type(return_type->get_expression());
         fun->set_parameters({ lhs_arg, rhs_arg });
         fun->set_eval(eval);
+        fun->set_vm_intrinsic(intrinsic);
         fun->set_intrinsic_codegen(
             [return_type, lhs = std::move(lhs), rhs = std::move(rhs)](
                 ir_generation_context & ctx, std::vector<codegen::ir::value> arguments) {
@@ -96,7 +98,11 @@ inline namespace _v1
                     .release());                                                                             \
         };                                                                                                   \
         static auto NAME = _generate_function<codegen::ir::integer_##NAME##_instruction>(                    \
-            BUILTIN_NAME, "<builtin integer " #NAME ">", eval, builtin_types().RESULT_TYPE.get());           \
+            BUILTIN_NAME,                                                                                    \
+            "<builtin integer " #NAME ">",                                                                   \
+            eval,                                                                                            \
+            builtin_types().RESULT_TYPE.get(),                                                               \
+            { vm::opcode::integer_##NAME });                                                                 \
         return NAME.get();                                                                                   \
     }
 
@@ -105,6 +111,6 @@ inline namespace _v1
     ADD_OPERATION(multiplication, U"__builtin_integer_operator_star", *, integer);
     ADD_OPERATION(equal_comparison, U"__builtin_integer_operator_equals", ==, boolean);
     ADD_OPERATION(less_comparison, U"__builtin_integer_operator_less", <, boolean);
-    ADD_OPERATION(less_equal_comparison, U"__builtin_integer_operator_less_equal", <, boolean);
+    ADD_OPERATION(less_equal_comparison, U"__builtin_integer_operator_less_equal", <=, boolean);
 }
 }
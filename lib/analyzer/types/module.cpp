@@ -30,12 +30,13 @@ inline namespace _v1
 {
     void module_type::add_symbol(std::string name, expression * entity, bool is_visible)
     {
-        auto symbol = make_symbol(utf32(name), entity);
+        auto interned = interned_string::from_utf8(name);
+        auto symbol = make_symbol(interned, entity);
         if (!is_visible)
         {
             symbol->hide();
         }
-        _member_scope->init(utf32(name), std::move(symbol));
+        _member_scope->init(interned, std::move(symbol));
     }
 
     void module_type::close_scope()
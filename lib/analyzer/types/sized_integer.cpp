@@ -26,6 +26,7 @@
 #include "vapor/analyzer/expressions/sized_integer.h"
 #include "vapor/analyzer/semantic/symbol.h"
 #include "vapor/analyzer/types/boolean.h"
+#include "vapor/analyzer/types/sized_arithmetic.h"
 #include "vapor/codegen/ir/type.h"
 #include "vapor/codegen/ir/variable.h"
 
@@ -64,7 +65,8 @@ inline namespace _v1
     auto sized_integer::_generate_function(std::u32string name,
         std::string desc,
         Eval eval,
-        type * return_type)
+        type * return_type,
+        vm::intrinsic intrinsic)
     {
         auto lhs = make_runtime_value(this);
         auto rhs = make_runtime_value(this);
@@ -77,6 +79,7 @@ inline namespace _v1
         fun->set_return_type(return_type->get_expression());
         fun->set_parameters({ lhs_arg, rhs_arg });
         fun->set_eval(eval);
+        fun->set_vm_intrinsic(intrinsic);
         fun->set_intrinsic_codegen(
             [name = std::move(name), return_type, lhs = std::move(lhs), rhs = std::move(rhs)](
                 ir_generation_context & ctx, std::vector<codegen::ir::value> arguments) {
@@ -92,9 +95,7 @@ inline namespace _v1
         return fun;
     }
 
-#define EXPAND(...) __VA_ARGS__
-
-#define ADD_OPERATION(NAME, BUILTIN_NAME, OPERATOR, RESULT_TYPE, CONSTANT_TYPE, ADDITIONAL_ARG)              \
+#define ADD_OPERATION(NAME, BUILTIN_NAME, RESULT_TYPE, FOLD)                                                \
     {                                                                                                        \
         auto eval = [=](auto &&, const std::vector<expression *> & args) {                                   \
             assert(args.size() == 2);                                                                        \
@@ -108,61 +109,55 @@ inline namespace _v1
                                                                                                              \
             auto lhs = args[0]->as<sized_integer_constant>();                                                \
             auto rhs = args[1]->as<sized_integer_constant>();                                                \
-            return make_ready_future<expression *>(std::make_unique<CONSTANT_TYPE##_constant>(               \
-                EXPAND ADDITIONAL_ARG lhs->get_value() OPERATOR rhs->get_value())                            \
-                                                       .release());                                          \
+            return make_ready_future<expression *>(FOLD(lhs, rhs).release());                                \
         };                                                                                                   \
         _##NAME = _generate_function<codegen::ir::integer_##NAME##_instruction>(BUILTIN_NAME,                \
             "<builtin sized_integer(" + std::to_string(_size) + ") " #NAME ">",                              \
             eval,                                                                                            \
-            RESULT_TYPE);                                                                                    \
+            RESULT_TYPE,                                                                                     \
+            { vm::opcode::sized_##NAME, static_cast<std::uint32_t>(_size) });                                \
     }
 
-    sized_integer::sized_integer(std::size_t size) : _size{ size }
+#define ADD_ARITHMETIC_OPERATION(NAME, BUILTIN_NAME)                                                         \
+    ADD_OPERATION(NAME, BUILTIN_NAME, this, [&](auto && lhs, auto && rhs) {                                  \
+        auto op = sized_arithmetic::operation::NAME;                                                         \
+        if (_size <= sized_arithmetic::max_fast_width)                                                       \
+        {                                                                                                    \
+            auto result =                                                                                    \
+                sized_arithmetic::apply(op, lhs->get_small_value(), rhs->get_small_value(), _size);          \
+            return result ? std::make_unique<sized_integer_constant>(this, result.value()) : nullptr;        \
+        }                                                                                                    \
+                                                                                                             \
+        auto result = sized_arithmetic::apply(op, lhs->get_value(), rhs->get_value(), _size);                \
+        return result ? std::make_unique<sized_integer_constant>(this, std::move(result.value())) : nullptr; \
+    })
+
+#define ADD_COMPARISON_OPERATION(NAME, BUILTIN_NAME, OPERATOR)                                               \
+    ADD_OPERATION(NAME, BUILTIN_NAME, builtin_types().boolean.get(), [&](auto && lhs, auto && rhs) {         \
+        return std::make_unique<boolean_constant>(_size <= sized_arithmetic::max_fast_width                  \
+                ? lhs->get_small_value() OPERATOR rhs->get_small_value()                                     \
+                : lhs->get_value() OPERATOR rhs->get_value());                                               \
+    })
+
+    sized_integer::sized_integer(std::size_t size) : type{ kind::sized_integer }, _size{ size }
     {
         auto u32size = utf32(std::to_string(size));
 
-        ADD_OPERATION(addition,
-            U"__builtin_sized_integer_" + u32size + U"_operator_plus",
-            +,
-            this,
-            sized_integer,
-            (this, ));
-        ADD_OPERATION(subtraction,
-            U"__builtin_sized_integer_" + u32size + U"_operator_minus",
-            -,
-            this,
-            sized_integer,
-            (this, ));
-        ADD_OPERATION(
-            multiplication, U"__builtin_sized_integer_" + u32size + U"_operator_star", *, this, sized_integer, (this, ));
-        ADD_OPERATION(division,
-            U"__builtin_sized_integer_" + u32size + U"_operator_slash",
-            /,
-            this,
-            sized_integer,
-            (this, ));
-        ADD_OPERATION(equal_comparison,
-            U"__builtin_sized_integer_" + u32size + U"_operator_equals",
-            ==,
-            builtin_types().boolean.get(),
-            boolean,
-            ());
-        ADD_OPERATION(less_comparison,
-            U"__builtin_sized_integer_" + u32size + U"_operator_less",
-            <,
-            builtin_types().boolean.get(),
-            boolean,
-            ());
-        ADD_OPERATION(less_equal_comparison,
-            U"__builtin_sized_" + u32size + U"_integer_operator_less_equal",
-            <=,
-            builtin_types().boolean.get(),
-            boolean,
-            ());
-
-        _max_value = (boost::multiprecision::cpp_int(1) << _size) - 1;
-        _min_value = -_max_value - 1;
+        ADD_ARITHMETIC_OPERATION(addition, U"__builtin_sized_integer_" + u32size + U"_operator_plus");
+        ADD_ARITHMETIC_OPERATION(subtraction, U"__builtin_sized_integer_" + u32size + U"_operator_minus");
+        ADD_ARITHMETIC_OPERATION(multiplication, U"__builtin_sized_integer_" + u32size + U"_operator_star");
+        // division by zero isn't folded, so that it happens, and fails, at runtime
+        ADD_ARITHMETIC_OPERATION(division, U"__builtin_sized_integer_" + u32size + U"_operator_slash");
+        ADD_COMPARISON_OPERATION(
+            equal_comparison, U"__builtin_sized_integer_" + u32size + U"_operator_equals", ==);
+        ADD_COMPARISON_OPERATION(
+            less_comparison, U"__builtin_sized_integer_" + u32size + U"_operator_less", <);
+        ADD_COMPARISON_OPERATION(
+            less_equal_comparison, U"__builtin_sized_" + u32size + U"_integer_operator_less_equal", <=);
+
+        // the range of a two's complement integer of this width, which is what codegen emits
+        _min_value = -(boost::multiprecision::cpp_int(1) << (_size - 1));
+        _max_value = -_min_value - 1;
     }
 }
 }
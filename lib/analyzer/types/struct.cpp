@@ -99,7 +99,7 @@ inline namespace _v1
     struct_type::struct_type(ast_node parse,
         std::unique_ptr<scope> member_scope,
         std::vector<std::unique_ptr<declaration>> member_decls)
-        : user_defined_type{ std::move(member_scope) },
+        : user_defined_type{ kind::struct_type, std::move(member_scope) },
           _parse{ parse },
           _data_member_declarations{ std::move(member_decls) }
     {
@@ -175,6 +175,8 @@ inline namespace _v1
                 make_struct_expression(this->shared_from_this(), std::move(arg_copies)).release());
         });
 
+        _aggregate_ctor->set_vm_intrinsic(
+            { vm::opcode::make_aggregate, static_cast<std::uint32_t>(_data_members.size()) });
         _aggregate_ctor->set_name(U"constructor");
 
         _aggregate_ctor_promise->set(_aggregate_ctor.get());
@@ -265,6 +267,8 @@ inline namespace _v1
             return make_ready_future(repl.claim(base->_get_replacement()).release());
         });
 
+        _aggregate_copy_ctor->set_vm_intrinsic(
+            { vm::opcode::make_aggregate, static_cast<std::uint32_t>(_data_members.size()), true });
         _aggregate_copy_ctor->set_name(U"replacing_copy_constructor");
         _aggregate_copy_ctor->make_member();
 
@@ -312,7 +316,7 @@ inline namespace _v1
         {
             auto proto_member = t->add_data_members();
 
-            proto_member->set_name(utf8(member->get_name()));
+            proto_member->set_name(member->get_name().utf8());
             proto_member->set_allocated_type(member->get_type()->generate_interface_reference().release());
         }
 
@@ -37,7 +37,7 @@ namespace reaver::vapor::analyzer
 inline namespace _v1
 {
     typeclass_instance_type::typeclass_instance_type(typeclass * tc, std::vector<expression *> arguments)
-        : _arguments{ std::move(arguments) }, _ctx{ tc, _arguments }
+        : type{ kind::typeclass_instance_type }, _arguments{ std::move(arguments) }, _ctx{ tc, _arguments }
     {
         auto repl = _ctx.get_replacements();
         std::unordered_map<function *, block *> function_block_defs;
@@ -91,7 +91,7 @@ inline namespace _v1
 
             auto body_stmt = repl.copy_claim(it->second);
 
-            auto body_block = dynamic_cast<block *>(body_stmt.get());
+            auto body_block = dyn_cast<block>(body_stmt.get());
             assert(body_block);
             fn_instance.function_body.reset(body_block);
             body_stmt.release();
@@ -161,7 +161,7 @@ inline namespace _v1
             auto ret = member->member_codegen_ir(ctx);
 
             // set scopes on the overload set type
-            auto udt = dynamic_cast<codegen::ir::user_type *>(ret.type.get());
+            auto udt = dyn_cast<codegen::ir::user_type>(ret.type.get());
             assert(udt); // ...a type of an overload set better be an UDT...
             udt->scopes = codegen_scopes(ctx);
 
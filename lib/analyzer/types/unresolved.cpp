@@ -26,6 +26,7 @@
 #include <boost/functional/hash.hpp>
 
 #include "vapor/analyzer/expressions/expression_ref.h"
+#include "vapor/analyzer/expressions/import.h"
 #include "vapor/analyzer/expressions/struct_literal.h"
 #include "vapor/analyzer/expressions/typeclass.h"
 #include "vapor/analyzer/expressions/unresolved_type.h"
@@ -117,25 +118,11 @@ inline namespace _v1
     {
         if (!_analysis_future)
         {
-            constexpr auto get_udr = +[](precontext * prectx, const synthesized_udr & ref) {
-                auto it = prectx->imported_entities.find(ref);
-                if (it == prectx->imported_entities.end())
-                {
-                    logger::dlog(logger::crash) << "can't find an entity for a user defined reference "
-                                                << ref.module << "." << ref.name << styles::def;
-                    logger::default_logger().sync();
-                    assert(0);
-                }
-                auto expr = it->second.get();
-                assert(expr);
-                return expr;
-            };
-
             _analysis_future = std::get<0>(fmap(_reference,
                 make_overload_set([&](std::monostate) -> future<> { assert(0); },
 
                     [&ctx, this](_unresolved_reference & ref) -> future<> {
-                        auto expr = get_udr(ref.ctx, *ref.udr);
+                        auto expr = get_imported_entity(*ref.ctx, *ref.udr);
                         return expr->analyze(ctx).then([expr, this] {
                             auto type_expr = expr->as<type_expression>();
                             assert(type_expr);
@@ -159,7 +146,7 @@ inline namespace _v1
                         auto && symb = arch.lex_scope->get(arch.name);
                         auto && type_expr = symb->get_expression()->as<type_expression>();
                         assert(type_expr);
-                        assert(dynamic_cast<archetype *>(type_expr->get_value()));
+                        assert(isa<archetype>(type_expr->get_value()));
                         _resolved = type_expr->get_value();
 
                         return make_ready_future();
@@ -168,7 +155,7 @@ inline namespace _v1
                     [&ctx, this](_unresolved_typeclass_instance_type & inst_type) -> future<> {
                         return when_all(
                             fmap(inst_type.arguments, [&](auto && arg) { return arg->analyze(ctx); }))
-                            .then([&] { return get_udr(inst_type.ctx, *inst_type.tc); })
+                            .then([&] { return get_imported_entity(*inst_type.ctx, *inst_type.tc); })
                             .then([&](expression * tc_expr) {
                                 return tc_expr->analyze(ctx).then([tc_expr] { return tc_expr; });
                             })
@@ -0,0 +1,272 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include "vapor/analyzer/vm/cache.h"
+
+#include <boost/functional/hash.hpp>
+
+#include "vapor/sha.h"
+
+#include "evaluation_cache.pb.h"
+
+namespace reaver::vapor::analyzer
+{
+inline namespace _v1
+{
+    namespace vm
+    {
+        namespace
+        {
+            // part of every function digest; bump it whenever the meaning of the bytecode changes (opcode
+            // semantics, how values are represented), so results of older compilers are never reused
+            constexpr std::uint64_t bytecode_version = 2;
+
+            proto::evaluation_value to_proto(const value & val)
+            {
+                proto::evaluation_value ret;
+
+                if (auto sized = val.as_sized())
+                {
+                    ret.set_sized(*sized);
+                }
+                else if (auto boolean = val.as_boolean())
+                {
+                    ret.set_boolean(*boolean);
+                }
+                else if (auto integer = val.as_integer())
+                {
+                    ret.set_integer(integer->str());
+                }
+                else if (auto members = val.as_aggregate())
+                {
+                    auto & aggregate = *ret.mutable_aggregate_value();
+                    for (auto && member : **members)
+                    {
+                        *aggregate.add_members() = to_proto(member);
+                    }
+                }
+
+                return ret;
+            }
+
+            std::optional<value> from_proto(const proto::evaluation_value & val)
+            {
+                switch (val.value_case())
+                {
+                    case proto::evaluation_value::kSized:
+                        return value{ static_cast<std::int64_t>(val.sized()) };
+
+                    case proto::evaluation_value::kBoolean:
+                        return value{ val.boolean() };
+
+                    case proto::evaluation_value::kInteger:
+                        try
+                        {
+                            return value{ boost::multiprecision::cpp_int{ val.integer() } };
+                        }
+                        catch (std::runtime_error &)
+                        {
+                            return std::nullopt;
+                        }
+
+                    case proto::evaluation_value::kAggregateValue:
+                    {
+                        auto members = std::make_shared<std::vector<value>>();
+                        for (auto && member : val.aggregate_value().members())
+                        {
+                            auto member_value = from_proto(member);
+                            if (!member_value)
+                            {
+                                return std::nullopt;
+                            }
+                            members->push_back(std::move(member_value.value()));
+                        }
+                        return value{ aggregate{ std::move(members) } };
+                    }
+
+                    default:
+                        return std::nullopt;
+                }
+            }
+
+            void append(std::string & buffer, std::uint64_t number)
+            {
+                buffer.append(reinterpret_cast<const char *>(&number), sizeof(number));
+            }
+        }
+
+        std::size_t evaluation_cache::_key_hash::operator()(const _key & key) const
+        {
+            std::size_t seed = std::hash<std::string>()(key.function_digest);
+            for (auto && argument : key.arguments)
+            {
+                boost::hash_combine(seed, argument.hash());
+            }
+            return seed;
+        }
+
+        bool evaluation_cache::_key_equal::operator()(const _key & lhs, const _key & rhs) const
+        {
+            return lhs.function_digest == rhs.function_digest && lhs.arguments == rhs.arguments;
+        }
+
+        const std::string & evaluation_cache::_digest(const bytecode_function & function)
+        {
+            // kept on the function rather than in a map keyed by its address, which can be reused
+            if (!function.digest.empty())
+            {
+                return function.digest;
+            }
+
+            // callees are numbered in the order they are discovered, which makes the digest independent of
+            // where the functions are in memory, and lets recursive calls refer back to their callers
+            std::unordered_map<const bytecode_function *, std::uint64_t> indices{ { &function, 0 } };
+            std::vector<const bytecode_function *> order{ &function };
+            std::string buffer;
+            append(buffer, bytecode_version);
+
+            for (std::size_t i = 0; i < order.size(); ++i)
+            {
+                auto current = order[i];
+
+                append(buffer, current->parameter_count);
+                append(buffer, current->register_count);
+
+                append(buffer, current->code.size());
+                for (auto && inst : current->code)
+                {
+                    append(buffer, static_cast<std::uint64_t>(inst.op));
+                    append(buffer, inst.dst);
+                    append(buffer, inst.a);
+                    append(buffer, inst.b);
+                    append(buffer, inst.c);
+                }
+
+                append(buffer, current->constants.size());
+                for (auto && constant : current->constants)
+                {
+                    auto serialized = to_proto(constant).SerializeAsString();
+                    append(buffer, serialized.size());
+                    buffer += serialized;
+                }
+
+                append(buffer, current->callees.size());
+                for (auto && callee : current->callees)
+                {
+                    auto [it, inserted] = indices.emplace(callee, order.size());
+                    if (inserted)
+                    {
+                        order.push_back(callee);
+                    }
+                    append(buffer, it->second);
+                }
+            }
+
+            function.digest = sha256(buffer.data(), buffer.size());
+            return function.digest;
+        }
+
+        std::optional<value> evaluation_cache::get(const bytecode_function & function,
+            const std::vector<value> & arguments)
+        {
+            std::lock_guard<std::mutex> lock{ _lock };
+
+            auto it = _results.find(_key{ _digest(function), arguments });
+            if (it == _results.end())
+            {
+                return std::nullopt;
+            }
+
+            it->second.used = true;
+            return it->second.result;
+        }
+
+        void evaluation_cache::save(const bytecode_function & function,
+            std::vector<value> arguments,
+            value result)
+        {
+            std::lock_guard<std::mutex> lock{ _lock };
+            _results.insert_or_assign(
+                _key{ _digest(function), std::move(arguments) }, _entry{ std::move(result), true });
+        }
+
+        void evaluation_cache::load(std::istream & is)
+        {
+            proto::evaluation_cache serialized;
+            if (!serialized.ParseFromIstream(&is))
+            {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock{ _lock };
+
+            for (auto && evaluation : serialized.evaluations())
+            {
+                std::vector<value> arguments;
+                for (auto && argument : evaluation.arguments())
+                {
+                    auto argument_value = from_proto(argument);
+                    if (!argument_value)
+                    {
+                        break;
+                    }
+                    arguments.push_back(std::move(argument_value.value()));
+                }
+
+                auto result = from_proto(evaluation.result());
+                if (!result || arguments.size() != static_cast<std::size_t>(evaluation.arguments_size()))
+                {
+                    continue;
+                }
+
+                _results.emplace(_key{ evaluation.function_digest(), std::move(arguments) },
+                    _entry{ std::move(result.value()), false });
+            }
+        }
+
+        void evaluation_cache::store(std::ostream & os) const
+        {
+            proto::evaluation_cache serialized;
+
+            std::lock_guard<std::mutex> lock{ _lock };
+
+            for (auto && [key, entry] : _results)
+            {
+                if (!entry.used)
+                {
+                    continue;
+                }
+
+                auto & evaluation = *serialized.add_evaluations();
+                evaluation.set_function_digest(key.function_digest);
+                for (auto && argument : key.arguments)
+                {
+                    *evaluation.add_arguments() = to_proto(argument);
+                }
+                *evaluation.mutable_result() = to_proto(entry.result);
+            }
+
+            serialized.SerializeToOstream(&os);
+        }
+    }
+}
+}
@@ -0,0 +1,436 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include "vapor/analyzer/vm/interpreter.h"
+
+#include <cassert>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
+
+#include "vapor/analyzer/types/sized_arithmetic.h"
+
+namespace reaver::vapor::analyzer
+{
+inline namespace _v1
+{
+    namespace vm
+    {
+        namespace
+        {
+            struct arguments_hash
+            {
+                std::size_t operator()(const std::vector<value> & arguments) const
+                {
+                    std::size_t seed = 0;
+                    for (auto && argument : arguments)
+                    {
+                        boost::hash_combine(seed, argument.hash());
+                    }
+                    return seed;
+                }
+            };
+
+            struct frame
+            {
+                const bytecode_function * function;
+                std::size_t pc;
+                std::size_t base;
+                std::uint32_t result;
+                // the step the call started at, to tell calls that run over the budget for hot functions
+                std::size_t entered;
+                // set when the result of this frame is to be memoized
+                bool memoized = false;
+                std::vector<value> arguments = {};
+            };
+
+            std::optional<value> sized_operation(opcode op,
+                std::int64_t lhs,
+                std::int64_t rhs,
+                std::uint32_t width)
+            {
+                auto arithmetic = [&](sized_arithmetic::operation operation) -> std::optional<value> {
+                    auto result = sized_arithmetic::apply(operation, lhs, rhs, width);
+                    if (!result)
+                    {
+                        return std::nullopt;
+                    }
+                    return value{ result.value() };
+                };
+
+                switch (op)
+                {
+                    case opcode::sized_addition:
+                        return arithmetic(sized_arithmetic::operation::addition);
+                    case opcode::sized_subtraction:
+                        return arithmetic(sized_arithmetic::operation::subtraction);
+                    case opcode::sized_multiplication:
+                        return arithmetic(sized_arithmetic::operation::multiplication);
+                    case opcode::sized_division:
+                        return arithmetic(sized_arithmetic::operation::division);
+
+                    case opcode::sized_equal_comparison:
+                        return value{ lhs == rhs };
+                    case opcode::sized_less_comparison:
+                        return value{ lhs < rhs };
+                    case opcode::sized_less_equal_comparison:
+                        return value{ lhs <= rhs };
+
+                    default:
+                        return std::nullopt;
+                }
+            }
+
+            std::optional<value> integer_operation(opcode op,
+                const boost::multiprecision::cpp_int & lhs,
+                const boost::multiprecision::cpp_int & rhs)
+            {
+                switch (op)
+                {
+                    case opcode::integer_addition:
+                        return value{ boost::multiprecision::cpp_int{ lhs + rhs } };
+                    case opcode::integer_subtraction:
+                        return value{ boost::multiprecision::cpp_int{ lhs - rhs } };
+                    case opcode::integer_multiplication:
+                        return value{ boost::multiprecision::cpp_int{ lhs * rhs } };
+                    case opcode::integer_equal_comparison:
+                        return value{ lhs == rhs };
+                    case opcode::integer_less_comparison:
+                        return value{ lhs < rhs };
+                    case opcode::integer_less_equal_comparison:
+                        return value{ lhs <= rhs };
+
+                    default:
+                        return std::nullopt;
+                }
+            }
+        }
+
+        // the second tier: functions are pure, so once a function gets hot its results are remembered
+        struct profile::_function_profile
+        {
+            std::size_t calls = 0;
+            bool hot = false;
+            std::unordered_map<std::vector<value>, value, arguments_hash> results = {};
+        };
+
+        profile::profile() : _lock{}, _functions{}
+        {
+        }
+
+        profile::~profile() = default;
+
+        bool profile::enter(const bytecode_function * function, const limits & budget)
+        {
+            std::lock_guard<std::mutex> lock{ _lock };
+            auto & entry = _functions[function];
+            if (!entry)
+            {
+                entry = std::make_unique<_function_profile>();
+            }
+
+            if (++entry->calls > budget.hot_calls)
+            {
+                entry->hot = true;
+            }
+            return entry->hot;
+        }
+
+        void profile::mark_hot(const bytecode_function * function)
+        {
+            std::lock_guard<std::mutex> lock{ _lock };
+            auto & entry = _functions[function];
+            if (!entry)
+            {
+                entry = std::make_unique<_function_profile>();
+            }
+            entry->hot = true;
+        }
+
+        bool profile::is_hot(const bytecode_function * function) const
+        {
+            std::lock_guard<std::mutex> lock{ _lock };
+            auto it = _functions.find(function);
+            return it != _functions.end() && it->second->hot;
+        }
+
+        std::optional<value> profile::find_result(const bytecode_function * function,
+            const std::vector<value> & arguments) const
+        {
+            std::lock_guard<std::mutex> lock{ _lock };
+            auto it = _functions.find(function);
+            if (it == _functions.end())
+            {
+                return std::nullopt;
+            }
+
+            auto result = it->second->results.find(arguments);
+            if (result == it->second->results.end())
+            {
+                return std::nullopt;
+            }
+            return result->second;
+        }
+
+        void profile::save_result(const bytecode_function * function,
+            std::vector<value> arguments,
+            value result)
+        {
+            std::lock_guard<std::mutex> lock{ _lock };
+            auto & entry = _functions[function];
+            if (!entry)
+            {
+                entry = std::make_unique<_function_profile>();
+            }
+            entry->results.emplace(std::move(arguments), std::move(result));
+        }
+
+        std::optional<value> run(const bytecode_function & function,
+            std::vector<value> arguments,
+            limits budget,
+            profile * shared_profile)
+        {
+            if (!function.valid || arguments.size() != function.parameter_count)
+            {
+                return std::nullopt;
+            }
+
+            profile local_profile;
+            auto & profile = shared_profile ? *shared_profile : local_profile;
+
+            // with a shared profile, the evaluated function itself may have been hot in an earlier evaluation
+            auto memoized = profile.enter(&function, budget);
+            std::vector<value> memo_key;
+            if (memoized)
+            {
+                memo_key = arguments;
+                if (auto result = profile.find_result(&function, memo_key))
+                {
+                    return result;
+                }
+            }
+
+            // one register file for the whole evaluation; each frame owns a window of it
+            std::vector<value> registers(function.register_count);
+            std::move(arguments.begin(), arguments.end(), registers.begin());
+
+            std::vector<frame> frames{ frame{ &function, 0, 0, 0, 0, memoized, std::move(memo_key) } };
+
+            for (std::size_t steps = 0; steps < budget.steps; ++steps)
+            {
+                auto & current = frames.back();
+                assert(current.pc < current.function->code.size());
+                auto & inst = current.function->code[current.pc++];
+                auto reg = [&](std::uint32_t idx) -> value & { return registers[current.base + idx]; };
+
+                switch (inst.op)
+                {
+                    case opcode::constant:
+                        reg(inst.dst) = current.function->constants[inst.a];
+                        break;
+
+                    case opcode::copy:
+                        reg(inst.dst) = reg(inst.a);
+                        break;
+
+                    case opcode::sized_addition:
+                    case opcode::sized_subtraction:
+                    case opcode::sized_multiplication:
+                    case opcode::sized_division:
+                    case opcode::sized_equal_comparison:
+                    case opcode::sized_less_comparison:
+                    case opcode::sized_less_equal_comparison:
+                    {
+                        auto lhs = reg(inst.a).as_sized();
+                        auto rhs = reg(inst.b).as_sized();
+                        if (!lhs || !rhs)
+                        {
+                            return std::nullopt;
+                        }
+
+                        auto result = sized_operation(inst.op, *lhs, *rhs, inst.c);
+                        if (!result)
+                        {
+                            return std::nullopt;
+                        }
+                        reg(inst.dst) = std::move(*result);
+                        break;
+                    }
+
+                    case opcode::integer_addition:
+                    case opcode::integer_subtraction:
+                    case opcode::integer_multiplication:
+                    case opcode::integer_equal_comparison:
+                    case opcode::integer_less_comparison:
+                    case opcode::integer_less_equal_comparison:
+                    {
+                        auto lhs = reg(inst.a).as_integer();
+                        auto rhs = reg(inst.b).as_integer();
+                        if (!lhs || !rhs)
+                        {
+                            return std::nullopt;
+                        }
+
+                        auto result = integer_operation(inst.op, *lhs, *rhs);
+                        if (!result)
+                        {
+                            return std::nullopt;
+                        }
+                        reg(inst.dst) = std::move(*result);
+                        break;
+                    }
+
+                    case opcode::boolean_equal_comparison:
+                    {
+                        auto lhs = reg(inst.a).as_boolean();
+                        auto rhs = reg(inst.b).as_boolean();
+                        if (!lhs || !rhs)
+                        {
+                            return std::nullopt;
+                        }
+                        reg(inst.dst) = value{ *lhs == *rhs };
+                        break;
+                    }
+
+                    case opcode::make_aggregate:
+                    {
+                        auto members = std::make_shared<std::vector<value>>();
+                        members->reserve(inst.b);
+                        for (std::uint32_t i = 0; i < inst.b; ++i)
+                        {
+                            if (!reg(inst.a + i).is_set())
+                            {
+                                return std::nullopt;
+                            }
+                            members->push_back(reg(inst.a + i));
+                        }
+                        reg(inst.dst) = value{ aggregate{ std::move(members) } };
+                        break;
+                    }
+
+                    case opcode::extract:
+                    {
+                        auto members = reg(inst.a).as_aggregate();
+                        if (!members || inst.b >= (*members)->size())
+                        {
+                            return std::nullopt;
+                        }
+                        // copy first; dst may alias a
+                        auto member = (**members)[inst.b];
+                        reg(inst.dst) = std::move(member);
+                        break;
+                    }
+
+                    case opcode::jump:
+                        current.pc = inst.a;
+                        break;
+
+                    case opcode::jump_unless:
+                    {
+                        auto condition = reg(inst.a).as_boolean();
+                        if (!condition)
+                        {
+                            return std::nullopt;
+                        }
+                        if (!*condition)
+                        {
+                            current.pc = inst.b;
+                        }
+                        break;
+                    }
+
+                    case opcode::call:
+                    {
+                        auto callee = current.function->callees[inst.a];
+                        if (!callee->valid || inst.c != callee->parameter_count
+                            || frames.size() >= budget.depth)
+                        {
+                            return std::nullopt;
+                        }
+
+                        auto args = current.base + inst.b;
+
+                        auto hot = profile.enter(callee, budget);
+                        std::vector<value> arguments;
+                        if (hot)
+                        {
+                            arguments.assign(registers.begin() + args, registers.begin() + args + inst.c);
+
+                            if (auto result = profile.find_result(callee, arguments))
+                            {
+                                reg(inst.dst) = std::move(*result);
+                                break;
+                            }
+                        }
+
+                        auto base = registers.size();
+                        registers.resize(base + callee->register_count);
+                        for (std::uint32_t i = 0; i < inst.c; ++i)
+                        {
+                            registers[base + i] = registers[args + i];
+                        }
+
+                        // current is invalidated by the push
+                        frames.push_back(
+                            frame{ callee, 0, base, inst.dst, steps, hot, std::move(arguments) });
+                        break;
+                    }
+
+                    case opcode::ret:
+                    {
+                        auto result = std::move(reg(inst.a));
+                        if (!result.is_set())
+                        {
+                            return std::nullopt;
+                        }
+
+                        auto finished = std::move(current);
+                        frames.pop_back();
+
+                        if (finished.memoized)
+                        {
+                            profile.save_result(finished.function, std::move(finished.arguments), result);
+                        }
+                        // a single call this long is worth remembering the next time around, even if the
+                        // function isn't called often
+                        else if (steps - finished.entered > budget.hot_steps)
+                        {
+                            profile.mark_hot(finished.function);
+                        }
+
+                        if (frames.empty())
+                        {
+                            return result;
+                        }
+
+                        registers.resize(finished.base);
+                        registers[frames.back().base + finished.result] = std::move(result);
+                        break;
+                    }
+                }
+            }
+
+            return std::nullopt;
+        }
+    }
+}
+}
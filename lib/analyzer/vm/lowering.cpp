@@ -0,0 +1,543 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include "vapor/analyzer/vm/lowering.h"
+
+#include <algorithm>
+#include <cassert>
+#include <mutex>
+#include <unordered_map>
+
+#include "vapor/analyzer/expressions/boolean.h"
+#include "vapor/analyzer/expressions/call.h"
+#include "vapor/analyzer/expressions/expression_ref.h"
+#include "vapor/analyzer/expressions/integer.h"
+#include "vapor/analyzer/expressions/member_access.h"
+#include "vapor/analyzer/expressions/postfix.h"
+#include "vapor/analyzer/expressions/sized_integer.h"
+#include "vapor/analyzer/expressions/struct.h"
+#include "vapor/analyzer/expressions/type.h"
+#include "vapor/analyzer/semantic/function.h"
+#include "vapor/analyzer/statements/block.h"
+#include "vapor/analyzer/statements/declaration.h"
+#include "vapor/analyzer/statements/if.h"
+#include "vapor/analyzer/statements/return.h"
+#include "vapor/analyzer/types/sized_arithmetic.h"
+#include "vapor/analyzer/types/sized_integer.h"
+#include "vapor/analyzer/types/struct.h"
+
+namespace reaver::vapor::analyzer
+{
+inline namespace _v1
+{
+    namespace vm
+    {
+        namespace
+        {
+            // thrown out of the lowering of a body that uses something the vm doesn't support
+            struct unsupported
+            {
+            };
+
+            // sized integers are unboxed into 64 bits
+            constexpr std::size_t max_sized_width = sized_arithmetic::max_word_width;
+
+            struct_type * as_struct_type(type * t)
+            {
+                return dyn_cast<struct_type>(t);
+            }
+
+            std::uint32_t member_index(type * t, interned_string name)
+            {
+                auto str = as_struct_type(t);
+                if (!str)
+                {
+                    throw unsupported{};
+                }
+
+                auto && members = str->get_data_members();
+                auto it = std::find_if(members.begin(), members.end(), [&](auto && member) {
+                    return member->get_name() == name;
+                });
+                if (it == members.end())
+                {
+                    throw unsupported{};
+                }
+
+                return it - members.begin();
+            }
+
+            class lowering
+            {
+            public:
+                lowering(bytecode_function & out) : _out{ out }
+                {
+                }
+
+                void lower_function(function * fn)
+                {
+                    auto && params = fn->parameters();
+                    _out.parameter_count = params.size();
+                    for (auto && param : params)
+                    {
+                        _variables.emplace(param, _allocate());
+                    }
+
+                    _statement(fn->get_body());
+
+                    // falling off the end of a body that doesn't always return reads an unset register,
+                    // which fails the evaluation
+                    _emit({ opcode::ret, 0, _allocate() });
+                }
+
+            private:
+                std::uint32_t _allocate(std::uint32_t count = 1)
+                {
+                    auto ret = _out.register_count;
+                    _out.register_count += count;
+                    return ret;
+                }
+
+                std::size_t _emit(instruction inst)
+                {
+                    _out.code.push_back(inst);
+                    return _out.code.size() - 1;
+                }
+
+                std::uint32_t _constant(value val)
+                {
+                    auto reg = _allocate();
+                    _out.constants.push_back(std::move(val));
+                    _emit({ opcode::constant, reg, static_cast<std::uint32_t>(_out.constants.size() - 1) });
+                    return reg;
+                }
+
+                void _statement(statement * stmt)
+                {
+                    if (auto blk = dyn_cast<block>(stmt))
+                    {
+                        for (auto && inner : blk->get_statements())
+                        {
+                            _statement(inner.get());
+                        }
+
+                        if (blk->has_return_expression())
+                        {
+                            _emit({ opcode::ret, 0, _expression(blk->get_return_expression()) });
+                        }
+                        return;
+                    }
+
+                    if (auto ret = dyn_cast<return_statement>(stmt))
+                    {
+                        _emit({ opcode::ret, 0, _expression(ret->get_returned_expression()) });
+                        return;
+                    }
+
+                    if (auto decl = dyn_cast<declaration>(stmt))
+                    {
+                        auto init = decl->initializer_expression();
+                        if (!init)
+                        {
+                            throw unsupported{};
+                        }
+
+                        _variables.emplace(init.value(), _expression(init.value()));
+                        return;
+                    }
+
+                    if (auto if_stmt = dyn_cast<if_statement>(stmt))
+                    {
+                        auto condition = _expression(if_stmt->get_condition());
+                        auto skip_then = _emit({ opcode::jump_unless, 0, condition });
+                        _statement(if_stmt->get_then_block());
+
+                        if (auto else_block = if_stmt->get_else_block())
+                        {
+                            auto skip_else = _emit({ opcode::jump });
+                            _out.code[skip_then].b = _out.code.size();
+                            _statement(else_block);
+                            _out.code[skip_else].a = _out.code.size();
+                        }
+                        else
+                        {
+                            _out.code[skip_then].b = _out.code.size();
+                        }
+                        return;
+                    }
+
+                    if (auto expr = dyn_cast<expression>(stmt))
+                    {
+                        _expression(expr);
+                        return;
+                    }
+
+                    throw unsupported{};
+                }
+
+                std::uint32_t _member(expression * base, interned_string name)
+                {
+                    auto base_reg = _expression(base);
+                    auto reg = _allocate();
+                    _emit({ opcode::extract, reg, base_reg, member_index(base->get_type(), name) });
+                    return reg;
+                }
+
+                std::uint32_t _expression(expression * expr)
+                {
+                    // variables are found by the expression they were declared with, before any replacement;
+                    // resolving replacements would merge e.g. all the accesses to the same member
+                    for (auto ref = expr; ref;)
+                    {
+                        auto it = _variables.find(ref);
+                        if (it != _variables.end())
+                        {
+                            return it->second;
+                        }
+
+                        auto as_ref = dyn_cast<expression_ref>(ref);
+                        ref = as_ref ? as_ref->get_referenced() : nullptr;
+                    }
+
+                    if (auto ref = dyn_cast<expression_ref>(expr))
+                    {
+                        return _expression(ref->get_referenced());
+                    }
+
+                    // member accesses are lowered before resolving the replacement, which drops the base
+                    if (auto postfix = dyn_cast<postfix_expression>(expr))
+                    {
+                        if (auto && member = postfix->get_accessed_member())
+                        {
+                            return _member(postfix->get_base(), member.value());
+                        }
+                    }
+
+                    if (auto access = dyn_cast<member_access_expression>(expr))
+                    {
+                        if (auto referenced = access->get_referenced())
+                        {
+                            return _expression(referenced);
+                        }
+
+                        if (auto base = access->get_base())
+                        {
+                            return _member(const_cast<expression *>(base), access->get_name());
+                        }
+
+                        if (_replaced_bases.empty())
+                        {
+                            throw unsupported{};
+                        }
+
+                        auto [base_reg, base_type] = _replaced_bases.back();
+                        auto reg = _allocate();
+                        auto index = member_index(base_type, access->get_name());
+                        _emit({ opcode::extract, reg, base_reg, index });
+                        return reg;
+                    }
+
+                    if (auto val = to_value(expr))
+                    {
+                        return _constant(std::move(val.value()));
+                    }
+
+                    auto replacement = expr->_get_replacement();
+                    if (replacement != expr)
+                    {
+                        return _expression(replacement);
+                    }
+
+                    if (auto call = dyn_cast<call_expression>(expr))
+                    {
+                        return _call(call);
+                    }
+
+                    throw unsupported{};
+                }
+
+                // arguments to calls and aggregates go to consecutive registers
+                std::uint32_t _arguments(const std::vector<expression *> & args, std::size_t first = 0)
+                {
+                    std::vector<std::uint32_t> regs;
+                    for (auto it = args.begin() + first; it != args.end(); ++it)
+                    {
+                        regs.push_back(_expression(*it));
+                    }
+
+                    auto base = _allocate(regs.size());
+                    for (std::size_t i = 0; i < regs.size(); ++i)
+                    {
+                        _emit({ opcode::copy, static_cast<std::uint32_t>(base + i), regs[i] });
+                    }
+                    return base;
+                }
+
+                std::uint32_t _call(call_expression * call)
+                {
+                    auto fn = call->get_function();
+                    auto && args = call->get_arguments();
+
+                    if (fn->vtable_slot())
+                    {
+                        throw unsupported{};
+                    }
+
+                    if (auto && intrinsic = fn->get_vm_intrinsic())
+                    {
+                        auto reg = _allocate();
+
+                        switch (intrinsic->op)
+                        {
+                            case opcode::make_aggregate:
+                            {
+                                if (!intrinsic->replacing)
+                                {
+                                    auto members = _arguments(args);
+                                    _emit({ opcode::make_aggregate, reg, members, intrinsic->operand });
+                                    return reg;
+                                }
+
+                                auto base = args.front();
+                                _replaced_bases.emplace_back(_expression(base), base->get_type());
+                                auto members = _arguments(args, 1);
+                                _replaced_bases.pop_back();
+
+                                _emit({ opcode::make_aggregate, reg, members, intrinsic->operand });
+                                return reg;
+                            }
+
+                            case opcode::sized_addition:
+                            case opcode::sized_subtraction:
+                            case opcode::sized_multiplication:
+                            case opcode::sized_division:
+                            case opcode::sized_equal_comparison:
+                            case opcode::sized_less_comparison:
+                            case opcode::sized_less_equal_comparison:
+                                if (intrinsic->operand > max_sized_width)
+                                {
+                                    throw unsupported{};
+                                }
+                                [[fallthrough]];
+
+                            case opcode::integer_addition:
+                            case opcode::integer_subtraction:
+                            case opcode::integer_multiplication:
+                            case opcode::integer_equal_comparison:
+                            case opcode::integer_less_comparison:
+                            case opcode::integer_less_equal_comparison:
+                            case opcode::boolean_equal_comparison:
+                            {
+                                assert(args.size() == 2);
+                                auto lhs = _expression(args[0]);
+                                auto rhs = _expression(args[1]);
+                                _emit({ intrinsic->op, reg, lhs, rhs, intrinsic->operand });
+                                return reg;
+                            }
+
+                            default:
+                                throw unsupported{};
+                        }
+                    }
+
+                    if (!fn->get_body())
+                    {
+                        throw unsupported{};
+                    }
+
+                    auto callee = lower(fn);
+                    if (!callee)
+                    {
+                        throw unsupported{};
+                    }
+
+                    auto reg = _allocate();
+                    auto first = _arguments(args);
+                    _out.callees.push_back(callee);
+                    _emit({ opcode::call,
+                        reg,
+                        static_cast<std::uint32_t>(_out.callees.size() - 1),
+                        first,
+                        static_cast<std::uint32_t>(args.size()) });
+                    return reg;
+                }
+
+                bytecode_function & _out;
+                std::unordered_map<const expression *, std::uint32_t> _variables;
+                std::vector<std::pair<std::uint32_t, type *>> _replaced_bases;
+            };
+
+            // a recursive mutex, since lowering a function lowers its callees
+            std::recursive_mutex lowering_lock;
+        }
+
+        const bytecode_function * lower(function * fn)
+        {
+            std::lock_guard<std::recursive_mutex> lock{ lowering_lock };
+
+            // the bytecode is owned by the function, so it can't be found for another function that later
+            // gets the same address
+            if (auto lowered = fn->get_bytecode())
+            {
+                // a function that is still being lowered is returned as is, for recursive calls; one whose
+                // lowering failed is reported the same way every time
+                return lowered->valid || lowered->in_progress ? lowered : nullptr;
+            }
+
+            auto out = fn->make_bytecode();
+
+            if (!fn->get_body())
+            {
+                return nullptr;
+            }
+
+            out->in_progress = true;
+
+            try
+            {
+                lowering{ *out }.lower_function(fn);
+            }
+
+            catch (unsupported &)
+            {
+                out->code.clear();
+                out->constants.clear();
+                out->callees.clear();
+                out->in_progress = false;
+                return nullptr;
+            }
+
+            catch (...)
+            {
+                out->in_progress = false;
+                throw;
+            }
+
+            out->in_progress = false;
+            out->valid = true;
+            return out;
+        }
+
+        std::optional<value> to_value(const expression * expr)
+        {
+            expr = expr->_get_replacement();
+
+            if (auto integer = dyn_cast<integer_constant>(expr))
+            {
+                return value{ integer->get_value() };
+            }
+
+            if (auto sized = dyn_cast<sized_integer_constant>(expr))
+            {
+                if (static_cast<const sized_integer *>(sized->get_type())->size() > max_sized_width)
+                {
+                    return std::nullopt;
+                }
+                return value{ static_cast<std::int64_t>(sized->get_small_value()) };
+            }
+
+            if (auto boolean = dyn_cast<boolean_constant>(expr))
+            {
+                return value{ static_cast<bool>(boolean->get_value()) };
+            }
+
+            if (auto str = dyn_cast<struct_expression>(expr))
+            {
+                auto members = std::make_shared<std::vector<value>>();
+                for (auto && member : as_struct_type(str->get_type())->get_data_members())
+                {
+                    auto member_expr = str->get_member(member->get_name());
+                    auto member_value = member_expr ? to_value(member_expr) : std::nullopt;
+                    if (!member_value)
+                    {
+                        return std::nullopt;
+                    }
+                    members->push_back(std::move(member_value.value()));
+                }
+
+                return value{ aggregate{ std::move(members) } };
+            }
+
+            return std::nullopt;
+        }
+
+        // values can come from the persistent evaluation cache, so they are checked against the type
+        // instead of being trusted
+        std::unique_ptr<expression> to_expression(const value & val, type * value_type)
+        {
+            if (auto integer = val.as_integer())
+            {
+                if (value_type != builtin_types().integer.get())
+                {
+                    return nullptr;
+                }
+                return std::make_unique<integer_constant>(*integer);
+            }
+
+            if (auto sized = val.as_sized())
+            {
+                auto sized_type = dyn_cast<sized_integer>(value_type);
+                boost::multiprecision::cpp_int sized_value = *sized;
+                if (!sized_type || sized_value > sized_type->max_value()
+                    || sized_value < sized_type->min_value())
+                {
+                    return nullptr;
+                }
+                return std::make_unique<sized_integer_constant>(sized_type, int128{ *sized });
+            }
+
+            if (auto boolean = val.as_boolean())
+            {
+                if (value_type != builtin_types().boolean.get())
+                {
+                    return nullptr;
+                }
+                return std::make_unique<boolean_constant>(*boolean);
+            }
+
+            if (auto members = val.as_aggregate())
+            {
+                auto str = as_struct_type(value_type);
+                if (!str || str->get_data_members().size() != (*members)->size())
+                {
+                    return nullptr;
+                }
+
+                std::vector<std::unique_ptr<expression>> fields;
+                for (std::size_t i = 0; i < (*members)->size(); ++i)
+                {
+                    auto field = to_expression((**members)[i], str->get_data_members()[i]->get_type());
+                    if (!field)
+                    {
+                        return nullptr;
+                    }
+                    fields.push_back(std::move(field));
+                }
+
+                return make_struct_expression(str->shared_from_this(), std::move(fields));
+            }
+
+            return nullptr;
+        }
+    }
+}
+}
@@ -66,12 +66,12 @@ inline namespace _v1
             return U"i1";
         }
 
-        if (auto sized = dynamic_cast<const ir::sized_integer_type *>(type.get()))
+        if (auto sized = dyn_cast<ir::sized_integer_type>(type.get()))
         {
             return U"i" + utf32(std::to_string(sized->integer_size));
         }
 
-        if (auto function = dynamic_cast<const ir::function_type *>(type.get()))
+        if (auto function = dyn_cast<ir::function_type>(type.get()))
         {
             return type_name(function->return_type, ctx) + U" ("
                 + boost::join(fmap(function->parameter_types,
@@ -80,7 +80,7 @@ inline namespace _v1
                 + U") *"; // TODO: this decay to pointer to function should probably happen earlier?
         }
 
-        if (auto user = dynamic_cast<const ir::user_type *>(type.get()))
+        if (auto user = dyn_cast<ir::user_type>(type.get()))
         {
             std::u32string scopes;
             for (auto && scope : user->scopes)
@@ -104,7 +104,7 @@ inline namespace _v1
     {
         if (!var.name)
         {
-            var.name = utf32(std::to_string(ctx.unnamed_variable_index++));
+            var.name = interned_string::from_utf8(std::to_string(ctx.unnamed_variable_index++));
         }
 
         std::u32string scopes;
@@ -113,7 +113,7 @@ inline namespace _v1
             scopes += scope.name + U".";
         }
 
-        return (ctx.in_function_definition ? U"%\"" : U"@\"") + scopes + var.name.value() + U"\"";
+        return (ctx.in_function_definition ? U"%\"" : U"@\"") + scopes + var.name->str() + U"\"";
     }
 
     std::u32string llvm_ir_generator::variable_of(const ir::value & val, codegen_context & ctx)
@@ -159,7 +159,7 @@ inline namespace _v1
             make_overload_set(
                 [&](const ir::integer_value & val) {
                     std::ostringstream os;
-                    os << val.value;
+                    os << val.value.get();
                     return utf32(os.str());
                 },
                 [&](const ir::boolean_value & val) -> std::u32string {
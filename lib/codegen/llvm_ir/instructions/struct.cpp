@@ -89,7 +89,7 @@ inline namespace _v1
                     // TODO: the operand generated for this instruction should probably be ir::member_variable
                     // directly this also means that member_variable needs *index* in addition to offset
                     auto && member_name = label.name;
-                    auto user_type = dynamic_cast<ir::user_type *>(
+                    auto user_type = dyn_cast<ir::user_type>(
                         std::get<std::shared_ptr<ir::variable>>(inst.operands[0])->type.get());
                     assert(user_type);
                     auto & members = user_type->members;
@@ -109,7 +109,9 @@ inline namespace _v1
 
                     return index - 1;
                 },
-                [&](const ir::integer_value & index) { return index.value.convert_to<std::size_t>(); },
+                [&](const ir::integer_value & index) {
+                    return static_cast<std::size_t>(index.value.small_value());
+                },
                 [](auto &&) -> std::size_t { assert(0); })));
 
         return variable_of(inst.result, ctx) + U" = extractvalue " + type_of(inst.operands[0], ctx) + U" "
@@ -52,7 +52,7 @@ inline namespace _v1
             make_overload_set(
                 [&](const ir::integer_value & val) {
                     std::stringstream ss;
-                    ss << val.value;
+                    ss << val.value.get();
 
                     if (val.size)
                     {
@@ -66,7 +66,7 @@ inline namespace _v1
                 },
                 [&](const std::shared_ptr<ir::variable> & var) {
                     return U"variable @ " + _pointer_to_string(var.get()) + U" `"
-                        + (var->name ? _scope_string(var->scopes) + U"." + var->name.value() : U"") + U"`";
+                        + (var->name ? _scope_string(var->scopes) + U"." + var->name->str() : U"") + U"`";
                 },
                 [&](const ir::label & label) { return label.name; },
                 [&](const ir::struct_value & struct_val) -> std::u32string {
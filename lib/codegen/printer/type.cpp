@@ -35,7 +35,7 @@ inline namespace _v1
             return U"";
         }
 
-        if (auto user = dynamic_cast<ir::user_type *>(type.get()))
+        if (auto user = dyn_cast<ir::user_type>(type.get()))
         {
             std::u32string members;
 
@@ -98,6 +98,21 @@ inline namespace _v1
         return _source_path.value().string() + ".o";
     }
 
+    boost::filesystem::path compiler_options::evaluation_cache_path() const
+    {
+        return module_path().replace_extension(".vpre");
+    }
+
+    boost::filesystem::path compiler_options::source_hash_cache_path() const
+    {
+        if (auto dir = module_dir())
+        {
+            return dir.value() / "source_hashes.vprh";
+        }
+
+        return module_path().parent_path() / "source_hashes.vprh";
+    }
+
     void compiler_options::set_output_dir(boost::filesystem::path path)
     {
         _output_dir = std::move(path);
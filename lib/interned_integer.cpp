@@ -0,0 +1,157 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include "vapor/interned_integer.h"
+
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
+
+namespace reaver::vapor
+{
+inline namespace _v1
+{
+    namespace
+    {
+        class integer_table
+        {
+        public:
+            using entry_type = std::pair<const boost::multiprecision::cpp_int, std::atomic<std::size_t>>;
+
+            entry_type * get(const boost::multiprecision::cpp_int & value)
+            {
+                {
+                    // entries only drop to zero references under the unique lock, so anything found here is
+                    // still alive
+                    std::shared_lock<std::shared_mutex> lock{ _mutex };
+                    if (auto it = _entries.find(value); it != _entries.end())
+                    {
+                        it->second.fetch_add(1, std::memory_order_relaxed);
+                        return &*it;
+                    }
+                }
+
+                // unordered_map never moves its elements, so the entries can be handed out as pointers
+                std::unique_lock<std::shared_mutex> lock{ _mutex };
+                auto & entry = *_entries.try_emplace(value, 0).first;
+                entry.second.fetch_add(1, std::memory_order_relaxed);
+                return &entry;
+            }
+
+            void release(entry_type * entry)
+            {
+                auto count = entry->second.load(std::memory_order_relaxed);
+                while (count > 1)
+                {
+                    if (entry->second.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel))
+                    {
+                        return;
+                    }
+                }
+
+                std::unique_lock<std::shared_mutex> lock{ _mutex };
+                if (entry->second.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    _entries.erase(_entries.find(entry->first));
+                }
+            }
+
+            std::size_t size()
+            {
+                std::shared_lock<std::shared_mutex> lock{ _mutex };
+                return _entries.size();
+            }
+
+        private:
+            std::shared_mutex _mutex = {};
+            std::unordered_map<boost::multiprecision::cpp_int,
+                std::atomic<std::size_t>,
+                boost::hash<boost::multiprecision::cpp_int>>
+                _entries = {};
+        };
+
+        integer_table & table()
+        {
+            static integer_table instance;
+            return instance;
+        }
+    }
+
+    boost::multiprecision::cpp_int to_cpp_int(int128 value)
+    {
+        auto magnitude = value < 0 ? 0 - static_cast<uint128>(value) : static_cast<uint128>(value);
+
+        boost::multiprecision::cpp_int ret = static_cast<std::uint64_t>(magnitude >> 64);
+        ret <<= 64;
+        ret |= static_cast<std::uint64_t>(magnitude);
+
+        return value < 0 ? -ret : ret;
+    }
+
+    std::optional<int128> to_int128(const boost::multiprecision::cpp_int & value)
+    {
+        static const auto min = to_cpp_int(static_cast<int128>(uint128(1) << 127));
+        static const auto max = to_cpp_int(static_cast<int128>(~uint128(0) >> 1));
+
+        if (value < min || value > max)
+        {
+            return std::nullopt;
+        }
+
+        boost::multiprecision::cpp_int magnitude = abs(value);
+        auto low = (magnitude & std::numeric_limits<std::uint64_t>::max()).convert_to<std::uint64_t>();
+        auto high = (magnitude >> 64).convert_to<std::uint64_t>();
+        auto ret = (static_cast<uint128>(high) << 64) | low;
+
+        // unsigned negation, so that the minimum doesn't overflow
+        return static_cast<int128>(value < 0 ? 0 - ret : ret);
+    }
+
+    interned_integer::interned_integer(const boost::multiprecision::cpp_int & value)
+        : _small{ 0 }
+    {
+        if (auto small = to_int128(value))
+        {
+            _small = small.value();
+            return;
+        }
+
+        _entry = table().get(value);
+    }
+
+    interned_integer::~interned_integer()
+    {
+        if (_entry)
+        {
+            table().release(_entry);
+        }
+    }
+
+    std::size_t interned_integer::table_size()
+    {
+        return table().size();
+    }
+}
+}
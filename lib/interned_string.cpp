@@ -0,0 +1,116 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include "vapor/interned_string.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "vapor/utf.h"
+
+namespace reaver::vapor
+{
+inline namespace _v1
+{
+    namespace
+    {
+        class string_table
+        {
+            using entry = interned_string::entry;
+
+        public:
+            const entry * get(std::u32string_view str)
+            {
+                {
+                    std::shared_lock<std::shared_mutex> lock{ _mutex };
+                    if (auto it = _by_utf32.find(str); it != _by_utf32.end())
+                    {
+                        return it->second;
+                    }
+                }
+
+                return _insert(entry{ utf8(std::u32string{ str }), std::u32string{ str } });
+            }
+
+            const entry * get(std::string_view str)
+            {
+                {
+                    std::shared_lock<std::shared_mutex> lock{ _mutex };
+                    if (auto it = _by_utf8.find(str); it != _by_utf8.end())
+                    {
+                        return it->second;
+                    }
+                }
+
+                return _insert(entry{ std::string{ str }, utf32(str) });
+            }
+
+        private:
+            const entry * _insert(entry e)
+            {
+                std::unique_lock<std::shared_mutex> lock{ _mutex };
+
+                // somebody might have inserted the same string in the meantime
+                if (auto it = _by_utf8.find(e.utf8); it != _by_utf8.end())
+                {
+                    return it->second;
+                }
+
+                // deque never moves its elements, so the views used as keys stay valid
+                auto & stored = _entries.emplace_back(std::move(e));
+                _by_utf8.emplace(stored.utf8, &stored);
+                _by_utf32.emplace(stored.utf32, &stored);
+                return &stored;
+            }
+
+            std::shared_mutex _mutex;
+            std::deque<entry> _entries;
+            std::unordered_map<std::string_view, const entry *> _by_utf8;
+            std::unordered_map<std::u32string_view, const entry *> _by_utf32;
+        };
+
+        string_table & table()
+        {
+            static string_table instance;
+            return instance;
+        }
+    }
+
+    interned_string::interned_string(std::u32string_view str)
+        : _entry{ str.empty() ? nullptr : table().get(str) }
+    {
+    }
+
+    interned_string interned_string::from_utf8(std::string_view str)
+    {
+        return { str.empty() ? nullptr : table().get(str) };
+    }
+
+    const interned_string::entry & interned_string::_empty()
+    {
+        static const entry empty;
+        return empty;
+    }
+}
+}
@@ -20,177 +20,121 @@
  *
  **/
 
-#include <reaver/unit.h>
+#include <array>
+#include <cstdint>
 
 #include "vapor/lexer.h"
+#include "vapor/lexer/detail/recognizer.h"
 
 namespace reaver::vapor::lexer
 {
 inline namespace _v1
 {
-    std::array<std::string, +token_type::count> token_types;
-
-    static auto token_types_init = []() -> reaver::unit {
-        token_types[+token_type::identifier] = "identifier";
-        token_types[+token_type::string] = "string";
-        token_types[+token_type::integer] = "integer";
-        token_types[+token_type::integer_suffix] = "integer-suffix";
-        token_types[+token_type::boolean] = "boolean";
-
-        token_types[+token_type::module] = "module";
-        token_types[+token_type::import] = "import";
-        token_types[+token_type::export_] = "export";
-
-        token_types[+token_type::let] = "let";
-        token_types[+token_type::return_] = "return";
-        token_types[+token_type::function] = "function";
-        token_types[+token_type::struct_] = "struct";
-
-        token_types[+token_type::typeclass] = "typeclass";
-        token_types[+token_type::implicit] = "implicit";
-        token_types[+token_type::instance] = "instance";
-        token_types[+token_type::default_] = "default";
-
-        token_types[+token_type::if_] = "if";
-        token_types[+token_type::else_] = "else";
-
-        token_types[+token_type::comma] = ",";
-        token_types[+token_type::dot] = ".";
-
-        token_types[+token_type::curly_bracket_open] = "{";
-        token_types[+token_type::curly_bracket_close] = "}";
-        token_types[+token_type::square_bracket_open] = "[";
-        token_types[+token_type::square_bracket_close] = "]";
-        token_types[+token_type::round_bracket_open] = "(";
-        token_types[+token_type::round_bracket_close] = ")";
-        token_types[+token_type::angle_bracket_open] = "<";
-        token_types[+token_type::angle_bracket_close] = ">";
-        token_types[+token_type::colon] = ":";
-        token_types[+token_type::semicolon] = ";";
-        token_types[+token_type::map] = "->>";
-        token_types[+token_type::indirection] = "->";
-        token_types[+token_type::assign] = "=";
-        token_types[+token_type::block_value] = "=>";
-
-        token_types[+token_type::logical_not] = "!";
-        token_types[+token_type::bitwise_not] = "~";
-        token_types[+token_type::bitwise_not_assignment] = "~=";
-
-        token_types[+token_type::plus] = "+";
-        token_types[+token_type::minus] = "-";
-        token_types[+token_type::star] = "*";
-        token_types[+token_type::slash] = "/";
-        token_types[+token_type::modulo] = "%";
-        token_types[+token_type::bitwise_and] = "&";
-        token_types[+token_type::bitwise_or] = "|";
-        token_types[+token_type::bitwise_xor] = "^";
-        token_types[+token_type::logical_and] = "&&";
-        token_types[+token_type::logical_or] = "||";
-        token_types[+token_type::right_shift] = ">>";
-        token_types[+token_type::left_shift] = "<<";
-
-        token_types[+token_type::plus_assignment] = "+=";
-        token_types[+token_type::minus_assignment] = "-=";
-        token_types[+token_type::star_assignment] = "*=";
-        token_types[+token_type::slash_assignment] = "/=";
-        token_types[+token_type::modulo_assignment] = "%=";
-        token_types[+token_type::bitwise_and_assignment] = "&=";
-        token_types[+token_type::bitwise_or_assignment] = "|=";
-        token_types[+token_type::bitwise_xor_assignment] = "^=";
-        token_types[+token_type::logical_and_assignment] = "&&=";
-        token_types[+token_type::logical_or_assignment] = "||=";
-        token_types[+token_type::right_shift_assignment] = ">>=";
-        token_types[+token_type::left_shift_assignment] = "<<=";
-
-        token_types[+token_type::equals] = "==";
-        token_types[+token_type::not_equals] = "!=";
-        token_types[+token_type::less_equal] = "<=";
-        token_types[+token_type::greater_equal] = ">=";
-
-        token_types[+token_type::increment] = "++";
-        token_types[+token_type::decrement] = "--";
-
-        token_types[+token_type::lambda] = u8"λ";
-
-        token_types[+token_type::none] = "<EMPTY TOKEN>";
-
-        return {};
-    }();
-
-    const std::unordered_map<std::u32string, token_type> keywords = {
-        { U"lambda", token_type::lambda },
-
-        { U"true", token_type::boolean },
-        { U"false", token_type::boolean },
-
-        { U"module", token_type::module },
-        { U"import", token_type::import },
-        { U"export", token_type::export_ },
-
-        { U"let", token_type::let },
-        { U"return", token_type::return_ },
-        { U"function", token_type::function },
-        { U"struct", token_type::struct_ },
-
-        { U"typeclass", token_type::typeclass },
-        { U"implicit", token_type::implicit },
-        { U"instance", token_type::instance },
-        { U"default", token_type::default_ },
-
-        { U"if", token_type::if_ },
-        { U"else", token_type::else_ },
-    };
-
-    const std::unordered_map<char32_t, token_type> symbols1 = {
-        { '.', token_type::dot },
-        { ',', token_type::comma },
-        { '{', token_type::curly_bracket_open },
-        { '}', token_type::curly_bracket_close },
-        { '[', token_type::square_bracket_open },
-        { ']', token_type::square_bracket_close },
-        { '(', token_type::round_bracket_open },
-        { ')', token_type::round_bracket_close },
-        { '<', token_type::angle_bracket_open },
-        { '>', token_type::angle_bracket_close },
-        { ':', token_type::colon },
-        { ';', token_type::semicolon },
-        { '=', token_type::assign },
-
-        { '!', token_type::logical_not },
-        { '~', token_type::bitwise_not },
-
-        { '+', token_type::plus },
-        { '-', token_type::minus },
-        { '*', token_type::star },
-        { '/', token_type::slash },
-        { '%', token_type::modulo },
-        { '&', token_type::bitwise_and },
-        { '|', token_type::bitwise_or },
-        { '^', token_type::bitwise_xor },
-        { U'λ', token_type::lambda },
-    };
-
-    const std::unordered_map<char32_t, std::unordered_map<char32_t, token_type>> symbols2 = {
-        { '<', { { '<', token_type::left_shift }, { '=', token_type::less_equal } } },
-        { '>', { { '>', token_type::right_shift }, { '=', token_type::greater_equal } } },
-        { '=', { { '>', token_type::block_value }, { '=', token_type::equals } } },
-        { '&', { { '&', token_type::logical_and }, { '=', token_type::bitwise_and_assignment } } },
-        { '|', { { '|', token_type::logical_or }, { '=', token_type::bitwise_and_assignment } } },
-        { '!', { { '=', token_type::not_equals } } },
-        { '~', { { '=', token_type::bitwise_not_assignment } } },
-        { '+', { { '=', token_type::plus_assignment } } },
-        { '-', { { '>', token_type::indirection }, { '=', token_type::minus_assignment } } },
-        { '*', { { '=', token_type::star_assignment } } },
-        { '/', { { '=', token_type::slash_assignment } } },
-        { '%', { { '=', token_type::modulo_assignment } } },
-        { '&', { { '=', token_type::bitwise_and_assignment } } },
-        { '|', { { '=', token_type::bitwise_or_assignment } } },
-        { '^', { { '=', token_type::bitwise_xor_assignment } } }
-    };
-
-    const std::unordered_map<char32_t, std::unordered_map<char32_t, std::unordered_map<char32_t, token_type>>>
-        symbols3 = {
-            { '-', { { '>', { { '>', token_type::map } } } } },
-        };
+    namespace _detail
+    {
+        namespace
+        {
+            // a byte-wise trie of all the spellings in the token table
+            // state 0 is the root for symbols, state 1 is the root for keywords; a transition to 0 means none
+            constexpr std::size_t state_count = [] {
+                std::size_t ret = 2;
+
+                for (auto && desc : token_table)
+                {
+                    if (desc.kind != token_kind::special)
+                    {
+                        ret += desc.spelling.size();
+                    }
+                }
+
+                return ret;
+            }();
+
+            static_assert(state_count <= 256, "the recognizer's states no longer fit in a byte");
+
+            struct automaton
+            {
+                std::array<std::array<std::uint8_t, 256>, state_count> next;
+                std::array<token_type, state_count> accept;
+            };
+
+            constexpr automaton build_automaton()
+            {
+                automaton ret{};
+                std::size_t used = 2;
+
+                for (auto && desc : token_table)
+                {
+                    if (desc.kind == token_kind::special)
+                    {
+                        continue;
+                    }
+
+                    std::size_t state = desc.kind == token_kind::symbol ? 0 : 1;
+
+                    for (char c : desc.spelling)
+                    {
+                        auto & next = ret.next[state][static_cast<unsigned char>(c)];
+                        if (!next)
+                        {
+                            next = static_cast<std::uint8_t>(used++);
+                        }
+
+                        state = next;
+                    }
+
+                    if (ret.accept[state] != token_type::none)
+                    {
+                        throw "a spelling appears twice in the token table";
+                    }
+
+                    ret.accept[state] = desc.type;
+                }
+
+                return ret;
+            }
+
+            constexpr automaton recognizer = build_automaton();
+        }
+
+        std::pair<token_type, std::size_t> _match_symbol(const char * it, const char * end)
+        {
+            std::pair<token_type, std::size_t> ret{ token_type::none, 0 };
+            std::size_t state = 0;
+
+            for (auto begin = it; it != end; ++it)
+            {
+                state = recognizer.next[state][static_cast<unsigned char>(*it)];
+                if (!state)
+                {
+                    break;
+                }
+
+                if (recognizer.accept[state] != token_type::none)
+                {
+                    ret = { recognizer.accept[state], it - begin + 1 };
+                }
+            }
+
+            return ret;
+        }
+
+        token_type _classify_identifier(std::string_view identifier)
+        {
+            std::size_t state = 1;
+
+            for (char c : identifier)
+            {
+                state = recognizer.next[state][static_cast<unsigned char>(c)];
+                if (!state)
+                {
+                    return token_type::identifier;
+                }
+            }
+
+            auto type = recognizer.accept[state];
+            return type != token_type::none ? type : token_type::identifier;
+        }
+    }
 }
 }
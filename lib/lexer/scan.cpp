@@ -0,0 +1,190 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include <cassert>
+
+#include "vapor/lexer/detail/scan.h"
+
+namespace reaver::vapor::lexer
+{
+inline namespace _v1
+{
+    namespace _detail
+    {
+        // defined in scan_sse2.cpp and scan_avx2.cpp
+        // return nullptr when the respective instruction set isn't available for the target
+        const _scanner * _sse2_scanner();
+        const _scanner * _avx2_scanner();
+
+        namespace
+        {
+            bool is_white_space(char c)
+            {
+                return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+            }
+
+            bool is_decimal(char c)
+            {
+                return c >= '0' && c <= '9';
+            }
+
+            bool is_identifier(char c)
+            {
+                return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || is_decimal(c);
+            }
+
+            const _scanner scalar_scanner = {
+                [](const char * it, const char * end) {
+                    while (it != end && is_white_space(*it))
+                    {
+                        ++it;
+                    }
+                    return it;
+                },
+                [](const char * it, const char * end) {
+                    while (it != end && is_identifier(*it))
+                    {
+                        ++it;
+                    }
+                    return it;
+                },
+                [](const char * it, const char * end) {
+                    while (it != end && is_decimal(*it))
+                    {
+                        ++it;
+                    }
+                    return it;
+                },
+                [](const char * it, const char * end) {
+                    while (it != end && *it != '\n')
+                    {
+                        ++it;
+                    }
+                    return it;
+                },
+                [](const char * it, const char * end) {
+                    for (; end - it >= 2; ++it)
+                    {
+                        if (it[0] == '*' && it[1] == '/')
+                        {
+                            return it;
+                        }
+                    }
+                    return end;
+                },
+            };
+
+            const _scanner * get_scanner(scanner_kind kind)
+            {
+                switch (kind)
+                {
+                    case scanner_kind::scalar:
+                        return &scalar_scanner;
+                    case scanner_kind::sse2:
+                        return _sse2_scanner();
+                    case scanner_kind::avx2:
+                        return _avx2_scanner();
+                }
+
+                return nullptr;
+            }
+
+            bool cpu_supports(scanner_kind kind)
+            {
+                switch (kind)
+                {
+                    case scanner_kind::scalar:
+                        return true;
+
+#if defined(__x86_64__) || defined(__i386__)
+                    case scanner_kind::sse2:
+                        __builtin_cpu_init();
+                        return __builtin_cpu_supports("sse2");
+                    case scanner_kind::avx2:
+                        __builtin_cpu_init();
+                        return __builtin_cpu_supports("avx2");
+#endif
+
+                    default:
+                        return false;
+                }
+            }
+
+            scanner_kind best_scanner()
+            {
+                auto available = available_scanners();
+                return available.back();
+            }
+
+            scanner_kind current_kind = best_scanner();
+            const _scanner * current = get_scanner(current_kind);
+        }
+
+        const _scanner & _get_scanner()
+        {
+            return *current;
+        }
+    }
+
+    const char * scanner_name(scanner_kind kind)
+    {
+        switch (kind)
+        {
+            case scanner_kind::scalar:
+                return "scalar";
+            case scanner_kind::sse2:
+                return "sse2";
+            case scanner_kind::avx2:
+                return "avx2";
+        }
+
+        return "unknown";
+    }
+
+    std::vector<scanner_kind> available_scanners()
+    {
+        std::vector<scanner_kind> ret;
+
+        for (auto kind : { scanner_kind::scalar, scanner_kind::sse2, scanner_kind::avx2 })
+        {
+            if (_detail::get_scanner(kind) && _detail::cpu_supports(kind))
+            {
+                ret.push_back(kind);
+            }
+        }
+
+        return ret;
+    }
+
+    scanner_kind selected_scanner()
+    {
+        return _detail::current_kind;
+    }
+
+    void select_scanner(scanner_kind kind)
+    {
+        assert(_detail::get_scanner(kind) && _detail::cpu_supports(kind));
+        _detail::current_kind = kind;
+        _detail::current = _detail::get_scanner(kind);
+    }
+}
+}
@@ -0,0 +1,115 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include "vapor/lexer/detail/scan.h"
+
+#ifdef __SSE2__
+
+#include <emmintrin.h>
+
+#include "vapor/lexer/detail/simd_scan.h"
+
+namespace reaver::vapor::lexer
+{
+inline namespace _v1
+{
+    namespace _detail
+    {
+        namespace
+        {
+            struct sse2_ops
+            {
+                using vec = __m128i;
+                static constexpr int width = 16;
+
+                static vec load(const char * ptr)
+                {
+                    return _mm_loadu_si128(reinterpret_cast<const vec *>(ptr));
+                }
+
+                static vec set(char c)
+                {
+                    return _mm_set1_epi8(c);
+                }
+
+                static vec eq(vec lhs, vec rhs)
+                {
+                    return _mm_cmpeq_epi8(lhs, rhs);
+                }
+
+                static vec gt(vec lhs, vec rhs)
+                {
+                    return _mm_cmpgt_epi8(lhs, rhs);
+                }
+
+                static vec and_(vec lhs, vec rhs)
+                {
+                    return _mm_and_si128(lhs, rhs);
+                }
+
+                static vec or_(vec lhs, vec rhs)
+                {
+                    return _mm_or_si128(lhs, rhs);
+                }
+
+                static std::uint32_t mask(vec v)
+                {
+                    return static_cast<std::uint32_t>(_mm_movemask_epi8(v));
+                }
+            };
+
+            using scan = _simd_scan<sse2_ops>;
+
+            const _scanner sse2_scanner = {
+                &scan::skip_white_space,
+                &scan::skip_identifier,
+                &scan::skip_decimal,
+                &scan::find_line_end,
+                &scan::find_comment_end,
+            };
+        }
+
+        const _scanner * _sse2_scanner()
+        {
+            return &sse2_scanner;
+        }
+    }
+}
+}
+
+#else
+
+namespace reaver::vapor::lexer
+{
+inline namespace _v1
+{
+    namespace _detail
+    {
+        const _scanner * _sse2_scanner()
+        {
+            return nullptr;
+        }
+    }
+}
+}
+
+#endif
@@ -0,0 +1,95 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include "vapor/parser/arena.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace reaver::vapor::parser
+{
+inline namespace _v1
+{
+    void arena::_grow()
+    {
+        _blocks.push_back(std::make_unique<char[]>(_next_block_size));
+
+        _current = reinterpret_cast<std::uintptr_t>(_blocks.back().get());
+        _current_end = _current + _next_block_size;
+
+        // keep the number of blocks logarithmic in the size of the tree
+        _next_block_size = std::min<std::size_t>(_next_block_size * 2, 16 * 1024 * 1024);
+    }
+
+    void * arena::_allocate_dedicated(std::size_t size, std::size_t alignment)
+    {
+        _blocks.push_back(std::make_unique<char[]>(size + alignment));
+
+        auto begin = reinterpret_cast<std::uintptr_t>(_blocks.back().get());
+        return reinterpret_cast<void *>((begin + alignment - 1) & ~(alignment - 1));
+    }
+
+    void arena::adopt(arena && other)
+    {
+        std::unique_lock<std::mutex> lock{ _lock, std::defer_lock };
+        if (_synchronized)
+        {
+            lock.lock();
+        }
+
+        // the storage of the blocks doesn't move, and this arena keeps allocating from its own current block
+        _blocks.insert(_blocks.end(),
+            std::make_move_iterator(other._blocks.begin()),
+            std::make_move_iterator(other._blocks.end()));
+
+        other._blocks.clear();
+        other._current = 0;
+        other._current_end = 0;
+    }
+
+    namespace
+    {
+        thread_local arena * active_arena = nullptr;
+    }
+
+    arena & current_arena()
+    {
+        if (active_arena)
+        {
+            return *active_arena;
+        }
+
+        static auto fallback = new arena{ true };
+        return *fallback;
+    }
+
+    arena_scope::arena_scope(arena & a) : _previous{ active_arena }
+    {
+        active_arena = &a;
+    }
+
+    arena_scope::~arena_scope()
+    {
+        active_arena = _previous;
+    }
+}
+}
@@ -21,6 +21,13 @@
  **/
 
 #include "vapor/parser/ast.h"
+
+#include <algorithm>
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <vector>
+
 #include "vapor/parser/import_expression.h"
 #include "vapor/parser/module.h"
 #include "vapor/print_helpers.h"
@@ -34,11 +41,143 @@ namespace reaver::vapor::parser
 {
 inline namespace _v1
 {
-    ast parse_ast(lexer::iterator begin, lexer::iterator end)
+    namespace
+    {
+        // below this, starting threads costs more than parsing the modules
+        constexpr std::size_t parallel_parse_threshold = 16 * 1024;
+
+        using token_range = std::pair<lexer::buffer_iterator, lexer::buffer_iterator>;
+
+        // splits the tokens into top-level module definitions by matching braces
+        // returns nothing if they don't look like a sequence of modules; the sequential parser is left to
+        // report the error then
+        std::optional<std::vector<token_range>> split_modules(lexer::buffer_iterator begin,
+            lexer::buffer_iterator end)
+        {
+            std::vector<token_range> ret;
+
+            while (begin != end)
+            {
+                if (begin->type != lexer::token_type::module)
+                {
+                    return std::nullopt;
+                }
+
+                auto it = begin;
+                std::size_t depth = 0;
+                bool opened = false;
+
+                for (; it != end; ++it)
+                {
+                    if (it->type == lexer::token_type::curly_bracket_open)
+                    {
+                        ++depth;
+                        opened = true;
+                    }
+
+                    else if (it->type == lexer::token_type::curly_bracket_close)
+                    {
+                        if (depth == 0)
+                        {
+                            return std::nullopt;
+                        }
+
+                        if (--depth == 0)
+                        {
+                            ++it;
+                            break;
+                        }
+                    }
+                }
+
+                if (!opened || depth != 0)
+                {
+                    return std::nullopt;
+                }
+
+                ret.emplace_back(begin, it);
+                begin = it;
+            }
+
+            return ret;
+        }
+
+        // parses every module on a pool of threads, each with its own arena, which are then handed over to
+        // the ast's arena
+        // returns false if any of the modules failed to parse, or didn't consume exactly its range of tokens
+        bool parse_modules_in_parallel(ast & ret,
+            const std::vector<token_range> & modules,
+            std::size_t thread_count)
+        {
+            std::vector<std::optional<module>> results(modules.size());
+            std::vector<std::unique_ptr<arena>> arenas(thread_count);
+            std::atomic<std::size_t> next{ 0 };
+            std::atomic<bool> failed{ false };
+
+            auto worker = [&](std::size_t id) {
+                arenas[id] = std::make_unique<arena>();
+                arena_scope scope{ *arenas[id] };
+
+                for (auto idx = next++; idx < modules.size() && !failed; idx = next++)
+                {
+                    try
+                    {
+                        auto ctx = context{ modules[idx].first, modules[idx].second };
+                        results[idx] = parse_module(ctx);
+
+                        // the splitter and the parser disagree about where the module ends; let the
+                        // sequential parse deal with it
+                        if (ctx.begin != modules[idx].second)
+                        {
+                            failed = true;
+                        }
+                    }
+                    catch (...)
+                    {
+                        failed = true;
+                    }
+                }
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(thread_count - 1);
+            for (std::size_t i = 1; i < thread_count; ++i)
+            {
+                threads.emplace_back(worker, i);
+            }
+
+            worker(0);
+
+            for (auto && thread : threads)
+            {
+                thread.join();
+            }
+
+            for (auto && worker_arena : arenas)
+            {
+                ret.nodes->adopt(std::move(*worker_arena));
+            }
+
+            if (failed)
+            {
+                return false;
+            }
+
+            for (auto && result : results)
+            {
+                ret.module_definitions.push_back(std::move(*result));
+            }
+
+            return true;
+        }
+    }
+
+    ast parse_ast(lexer::buffer_iterator begin, lexer::buffer_iterator end, std::size_t thread_count)
     {
         ast ret;
+        arena_scope scope{ *ret.nodes };
 
-        auto ctx = context{ begin, end, {} };
+        auto ctx = context{ begin, end };
 
         while (peek(ctx, lexer::token_type::import))
         {
@@ -46,6 +185,24 @@ inline namespace _v1
             expect(ctx, lexer::token_type::semicolon);
         }
 
+        if (thread_count == 0)
+        {
+            thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        if (thread_count > 1 && ctx.begin != ctx.end)
+        {
+            auto modules = split_modules(ctx.begin, ctx.end);
+            if (modules && modules->size() > 1
+                && static_cast<std::size_t>(modules->back().second - modules->front().first)
+                    >= parallel_parse_threshold
+                && parse_modules_in_parallel(ret, *modules, std::min(thread_count, modules->size())))
+            {
+                return ret;
+            }
+        }
+
+        // this is also where errors found by the parallel parse are reported, exactly as they'd be without it
         while (ctx.begin != ctx.end)
         {
             ret.module_definitions.push_back(parse_module(ctx));
@@ -54,6 +211,12 @@ inline namespace _v1
         return ret;
     }
 
+    ast parse_ast(lexer::iterator begin, lexer::iterator end)
+    {
+        lexer::token_buffer buffer{ begin, end };
+        return parse_ast(buffer.begin(), buffer.end());
+    }
+
     std::ostream & operator<<(std::ostream & os, const ast & ast)
     {
         auto ctx = print_context{};
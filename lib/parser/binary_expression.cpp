@@ -32,116 +32,14 @@ inline namespace _v1
         return lhs.range == rhs.range && lhs.op == rhs.op && lhs.lhs == rhs.lhs && lhs.rhs == rhs.rhs;
     }
 
-    const std::vector<reaver::vapor::lexer::_v1::token_type> & binary_operators()
+    binary_expression parse_binary_expression(context & ctx, expression lhs, expression_special_modes mode)
     {
-        static std::vector<lexer::token_type> binary_ops = { lexer::token_type::plus,
-            lexer::token_type::minus,
-            lexer::token_type::star,
-            lexer::token_type::slash,
-            lexer::token_type::modulo,
-            lexer::token_type::bitwise_and,
-            lexer::token_type::bitwise_or,
-            lexer::token_type::bitwise_xor,
-            lexer::token_type::logical_and,
-            lexer::token_type::logical_or,
-            lexer::token_type::left_shift,
-            lexer::token_type::right_shift,
+        auto op = expect(ctx, peek(ctx)->type);
+        auto rhs = parse_expression(ctx, mode, precedence(op.type));
+        auto range = range_type{ lhs.range.start(), rhs.range.end() };
 
-            lexer::token_type::assign,
-            lexer::token_type::plus_assignment,
-            lexer::token_type::minus_assignment,
-            lexer::token_type::star_assignment,
-            lexer::token_type::slash_assignment,
-            lexer::token_type::modulo_assignment,
-            lexer::token_type::bitwise_and_assignment,
-            lexer::token_type::bitwise_or_assignment,
-            lexer::token_type::bitwise_xor_assignment,
-            lexer::token_type::logical_and_assignment,
-            lexer::token_type::logical_or_assignment,
-            lexer::token_type::left_shift_assignment,
-            lexer::token_type::right_shift_assignment,
-
-            lexer::token_type::equals,
-            lexer::token_type::not_equals,
-            lexer::token_type::less,
-            lexer::token_type::less_equal,
-            lexer::token_type::greater,
-            lexer::token_type::greater_equal,
-
-            lexer::token_type::indirection,
-            lexer::token_type::map,
-            lexer::token_type::bind };
-
-        return binary_ops;
-    }
-
-    const std::unordered_map<reaver::vapor::lexer::_v1::token_type, std::size_t> &
-    binary_operator_precedences()
-    {
-        static std::unordered_map<lexer::token_type, std::size_t> precedences = []() {
-            std::unordered_map<lexer::token_type, std::size_t> precedences;
-
-            precedences[lexer::token_type::indirection] = 0;
-
-            precedences[lexer::token_type::star] = 10;
-            precedences[lexer::token_type::slash] = 10;
-            precedences[lexer::token_type::modulo] = 10;
-
-            precedences[lexer::token_type::plus] = 15;
-            precedences[lexer::token_type::minus] = 15;
-
-            precedences[lexer::token_type::left_shift] = 20;
-            precedences[lexer::token_type::right_shift] = 20;
-
-            precedences[lexer::token_type::less] = 25;
-            precedences[lexer::token_type::less_equal] = 25;
-            precedences[lexer::token_type::greater] = 25;
-            precedences[lexer::token_type::greater_equal] = 25;
-
-            precedences[lexer::token_type::equals] = 30;
-            precedences[lexer::token_type::not_equals] = 30;
-
-            precedences[lexer::token_type::bitwise_and] = 35;
-            precedences[lexer::token_type::bitwise_xor] = 40;
-            precedences[lexer::token_type::bitwise_or] = 45;
-            precedences[lexer::token_type::logical_and] = 50;
-            precedences[lexer::token_type::logical_or] = 55;
-
-            for (auto t : { lexer::token_type::assign,
-                     lexer::token_type::plus_assignment,
-                     lexer::token_type::minus_assignment,
-                     lexer::token_type::star_assignment,
-                     lexer::token_type::slash_assignment,
-                     lexer::token_type::left_shift_assignment,
-                     lexer::token_type::right_shift_assignment,
-                     lexer::token_type::bitwise_and_assignment,
-                     lexer::token_type::bitwise_not_assignment,
-                     lexer::token_type::bitwise_or_assignment,
-                     lexer::token_type::bitwise_xor_assignment,
-                     lexer::token_type::logical_and_assignment,
-                     lexer::token_type::logical_or_assignment })
-            {
-                precedences[t] = 60;
-            }
-
-            return precedences;
-        }();
-
-        return precedences;
-    }
-
-    binary_expression parse_binary_expression(context & ctx, expression lhs)
-    {
-        binary_expression ret;
-
-        ret.lhs = std::move(lhs);
-        ret.op = expect(ctx, peek(ctx)->type);
-        ctx.operator_stack.push_back({ ret.op.type, operator_type::binary });
-        ret.rhs = parse_expression(ctx);
-        ctx.operator_stack.pop_back();
-        ret.range = { ret.lhs.range.start(), ret.rhs.range.end() };
-
-        return ret;
+        // built in one go; default-constructing the node and assigning the operands costs more than the parse
+        return { range, std::move(op), std::move(lhs), std::move(rhs) };
     }
 
     void print(const binary_expression & expr, std::ostream & os, print_context ctx)
@@ -152,7 +50,7 @@ inline namespace _v1
 
         print(expr.lhs, os, ctx.make_branch(false));
         os << styles::def << ctx.make_branch(false) << styles::subrule_name << "operator: " << styles::def
-           << utf8(expr.op.string) << '\n';
+           << expr.op.string << '\n';
         print(expr.rhs, os, ctx.make_branch(true));
     }
 }
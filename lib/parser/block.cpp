@@ -91,7 +91,7 @@ inline namespace _v1
         for (auto && element : bl.block_value)
         {
             fmap(element, [&](const auto & value) -> unit {
-                print(value, os, statements_ctx.make_branch(++idx == bl.block_value.size()));
+                print(unwrap(value), os, statements_ctx.make_branch(++idx == bl.block_value.size()));
                 return {};
             });
         }
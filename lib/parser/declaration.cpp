@@ -41,7 +41,7 @@ inline namespace _v1
         {
             if (mode != declaration_mode::module_scope)
             {
-                throw expectation_failure{ "declaration", U"export", ctx.begin->range };
+                throw expectation_failure{ "declaration", "export", ctx.begin->range };
             }
 
             ret.export_ = expect(ctx, lexer::token_type::export_);
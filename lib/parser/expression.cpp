@@ -32,110 +32,90 @@ inline namespace _v1
         return lhs.range == rhs.range && lhs.expression_value == rhs.expression_value;
     }
 
-    expression parse_expression(context & ctx, expression_special_modes mode)
+    namespace
     {
-        expression ret;
-
-        if (!peek(ctx))
+        template<typename T>
+        expression make_expression(T node)
         {
-            throw expectation_failure{ "expression" };
+            auto range = node.range;
+            return { range, std::move(node) };
         }
 
-        auto type = peek(ctx)->type;
-
-        switch (type)
+        expression parse_operand(context & ctx, expression_special_modes mode)
         {
-            case lexer::token_type::string:
-                ret.expression_value = parse_literal<lexer::token_type::string>(ctx);
-                break;
+            if (!peek(ctx))
+            {
+                throw expectation_failure{ "expression" };
+            }
 
-            case lexer::token_type::integer:
-                ret.expression_value = parse_literal<lexer::token_type::integer>(ctx);
-                break;
+            auto type = peek(ctx)->type;
 
-            case lexer::token_type::boolean:
-                ret.expression_value = parse_literal<lexer::token_type::boolean>(ctx);
-                break;
+            switch (type)
+            {
+                case lexer::token_type::string:
+                    return make_expression(parse_literal<lexer::token_type::string>(ctx));
 
-            case lexer::token_type::identifier:
-                ret.expression_value = parse_postfix_expression(ctx, mode);
-                break;
+                case lexer::token_type::integer:
+                    return make_expression(parse_literal<lexer::token_type::integer>(ctx));
 
-            case lexer::token_type::import:
-                ret.expression_value = parse_import_expression(ctx);
-                break;
+                case lexer::token_type::boolean:
+                    return make_expression(parse_literal<lexer::token_type::boolean>(ctx));
 
-            case lexer::token_type::lambda:
-                ret.expression_value = parse_lambda_expression(ctx);
-                break;
+                case lexer::token_type::identifier:
+                    return make_expression(parse_postfix_expression(ctx, mode));
 
-            case lexer::token_type::struct_:
-                ret.expression_value = parse_struct_literal(ctx);
-                break;
+                case lexer::token_type::import:
+                    return make_expression(parse_import_expression(ctx));
 
-            case lexer::token_type::dot:
-                ret.expression_value = parse_member_expression(ctx);
-                break;
+                case lexer::token_type::lambda:
+                    return make_expression(parse_lambda_expression(ctx));
 
-            case lexer::token_type::typeclass:
-                ret.expression_value = parse_typeclass_literal(ctx);
-                break;
+                case lexer::token_type::struct_:
+                    return make_expression(parse_struct_literal(ctx));
 
-            case lexer::token_type::instance:
-                ret.expression_value = parse_instance_literal(ctx);
-                break;
+                case lexer::token_type::dot:
+                    return make_expression(parse_member_expression(ctx));
+
+                case lexer::token_type::typeclass:
+                    return make_expression(parse_typeclass_literal(ctx));
 
-            default:
-                if (is_unary_operator(type))
-                {
-                    ret.expression_value = parse_unary_expression(ctx);
-                }
+                case lexer::token_type::instance:
+                    return make_expression(parse_instance_literal(ctx));
+
+                default:
+                    if (is_unary_operator(type))
+                    {
+                        return make_expression(parse_unary_expression(ctx, mode));
+                    }
 
-                else
-                {
                     throw expectation_failure{ "expression", ctx.begin->string, ctx.begin->range };
-                }
+            }
         }
+    }
+
+    expression parse_expression(context & ctx, expression_special_modes mode, std::size_t precedence_limit)
+    {
+        auto ret = parse_operand(ctx, mode);
 
-        if (peek(ctx))
+        // everything parsed so far becomes the left operand of the next operator, as long as that operator
+        // binds tightly enough; a chain of left-associative operators is built in this loop without recursing
+        while (auto next = peek(ctx))
         {
-            type = peek(ctx)->type;
-            if (is_binary_operator(type)
-                && !(mode == expression_special_modes::assignment && type == lexer::token_type::assign))
+            auto type = next->type;
+            if (!is_binary_operator(type)
+                || (mode == expression_special_modes::assignment && type == lexer::token_type::assign))
             {
-                auto p1 = precedence({ type, operator_type::binary });
-                auto p2 = ctx.operator_stack.size()
-                    ? std::make_optional(precedence(ctx.operator_stack.back()))
-                    : std::nullopt;
-                while (ctx.operator_stack.empty() || p1 < *p2
-                    || (p1 == *p2 && associativity(type) == assoc::right))
-                {
-                    fmap(ret.expression_value, [&](const auto & value) -> unit {
-                        ret.range = value.range;
-                        return {};
-                    });
-                    ret.expression_value = parse_binary_expression(ctx, std::move(ret));
-
-                    if (!peek(ctx))
-                    {
-                        break;
-                    }
-
-                    type = peek(ctx)->type;
-                    if (!is_binary_operator(type))
-                    {
-                        break;
-                    }
+                break;
+            }
 
-                    p1 = precedence({ type, operator_type::binary });
-                }
+            auto prec = precedence(type);
+            if (prec > precedence_limit || (prec == precedence_limit && associativity(type) == assoc::left))
+            {
+                break;
             }
-        }
 
-        fmap(ret.expression_value, [&](const auto & value) -> unit {
-            ret.range = value.range;
-            return {};
-        });
+            ret = make_expression(parse_binary_expression(ctx, std::move(ret), mode));
+        }
 
         return ret;
     }
@@ -147,7 +127,7 @@ inline namespace _v1
         os << "\n";
 
         fmap(expr.expression_value, [&](const auto & value) -> unit {
-            print(value, os, ctx.make_branch(true));
+            print(unwrap(value), os, ctx.make_branch(true));
             return {};
         });
     }
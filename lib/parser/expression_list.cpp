@@ -36,13 +36,6 @@ inline namespace _v1
     {
         expression_list ret;
 
-        // TODO: verify that this actually works as intended
-        // the way I originally used the operator stack can't possibly work when the expression context
-        // changes and I failed to notice that originally
-
-        auto stack = std::move(ctx.operator_stack);
-        ctx.operator_stack.clear();
-
         ret.expressions.push_back(parse_expression(ctx));
 
         if (peek(ctx, lexer::token_type::comma))
@@ -53,9 +46,6 @@ inline namespace _v1
 
         ret.range = { ret.expressions.front().range.start(), ret.expressions.back().range.end() };
 
-        assert(ctx.operator_stack.empty());
-        ctx.operator_stack = std::move(stack);
-
         return ret;
     }
 
@@ -31,6 +31,11 @@ namespace reaver::vapor::parser
 {
 inline namespace _v1
 {
+    bool operator==(const module & lhs, const module & rhs)
+    {
+        return lhs.range == rhs.range && lhs.name == rhs.name && lhs.statements == rhs.statements;
+    }
+
     module parse_module(context & ctx)
     {
         module ret;
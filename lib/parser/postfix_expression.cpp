@@ -113,16 +113,12 @@ inline namespace _v1
                 {
                     if (!peek(ctx, closing(*ret.modifier_type)))
                     {
-                        auto old_stack = std::move(ctx.operator_stack);
-
                         ret.arguments.push_back(parse_expression(ctx));
                         while (peek(ctx, lexer::token_type::comma))
                         {
                             expect(ctx, lexer::token_type::comma);
                             ret.arguments.push_back(parse_expression(ctx));
                         }
-
-                        ctx.operator_stack = std::move(old_stack);
                     }
                     end = expect(ctx, closing(*ret.modifier_type)).range.end();
                 }
@@ -154,7 +150,7 @@ inline namespace _v1
         auto base_expression_ctx = ctx.make_branch(!expr.modifier_type);
         os << '\n' << base_expression_ctx << styles::subrule_name << "base-expression:\n";
         fmap(expr.base_expression, [&](const auto & value) -> unit {
-            print(value, os, base_expression_ctx.make_branch(true));
+            print(unwrap(value), os, base_expression_ctx.make_branch(true));
             return {};
         });
 
@@ -168,7 +164,7 @@ inline namespace _v1
             if (expr.modifier_type == lexer::token_type::dot)
             {
                 os << ctx.make_branch(true) << styles::subrule_name << "accessed-member: '"
-                   << styles::string_value << utf8(expr.accessed_member->value.string) << styles::def
+                   << styles::string_value << expr.accessed_member->value.string << styles::def
                    << "'\n";
             }
 
@@ -49,7 +49,7 @@ inline namespace _v1
             if (mode != statement_mode::module)
             {
                 throw expectation_failure{
-                    "a non-exported statement", U"exported declaration", ctx.begin->range
+                    "a non-exported statement", "exported declaration", ctx.begin->range
                 };
             }
 
@@ -92,7 +92,7 @@ inline namespace _v1
             {
                 if (export_)
                 {
-                    throw expectation_failure{ "exported-declaration", U"if-statement", ctx.begin->range };
+                    throw expectation_failure{ "exported-declaration", "if-statement", ctx.begin->range };
                 }
 
                 auto if_ = parse_if_statement(ctx);
@@ -111,7 +111,7 @@ inline namespace _v1
                 if (export_)
                 {
                     throw expectation_failure{
-                        "exported-declaration", U"return-statement", ctx.begin->range
+                        "exported-declaration", "return-statement", ctx.begin->range
                     };
                 }
 
@@ -130,7 +130,7 @@ inline namespace _v1
                 if (export_)
                 {
                     throw expectation_failure{
-                        "exported-declaration", U"default-instance", ctx.begin->range
+                        "exported-declaration", "default-instance", ctx.begin->range
                     };
                 }
 
@@ -140,7 +140,7 @@ inline namespace _v1
             default:
                 if (export_)
                 {
-                    throw expectation_failure{ "exported-declaration", U"expression-list", ctx.begin->range };
+                    throw expectation_failure{ "exported-declaration", "expression-list", ctx.begin->range };
                 }
 
                 ret.statement_value = parse_expression_list(ctx);
@@ -27,20 +27,7 @@ namespace reaver::vapor::parser
 {
 inline namespace _v1
 {
-    const std::vector<reaver::vapor::lexer::_v1::token_type> & unary_operators()
-    {
-        static std::vector<lexer::token_type> unary_ops = { lexer::token_type::plus,
-            lexer::token_type::minus,
-            lexer::token_type::logical_not,
-            lexer::token_type::bitwise_not,
-            lexer::token_type::star,
-            lexer::token_type::increment,
-            lexer::token_type::decrement };
-
-        return unary_ops;
-    }
-
-    unary_expression parse_unary_expression(context & ctx)
+    unary_expression parse_unary_expression(context & ctx, expression_special_modes mode)
     {
         unary_expression ret;
 
@@ -48,9 +35,7 @@ inline namespace _v1
         if (is_unary_operator(t))
         {
             ret.op = expect(ctx, t);
-            ctx.operator_stack.push_back({ ret.op.type, operator_type::unary });
-            ret.operand = parse_expression(ctx);
-            ctx.operator_stack.pop_back();
+            ret.operand = parse_expression(ctx, mode, unary_precedence);
         }
 
         else
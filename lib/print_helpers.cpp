@@ -32,12 +32,7 @@ inline namespace _v1
     ast_node imported_ast_node(analyzer::precontext & ctx, const proto::range & r)
     {
         auto import_position = [&ctx](const proto::position p) {
-            position ret;
-            ret.offset = p.offset();
-            ret.line = p.line();
-            ret.column = p.column();
-            ret.file_path = ctx.module_path_stack.back().source;
-            return ret;
+            return position(static_cast<std::uint32_t>(p.offset()), ctx.module_path_stack.back().source_file);
         };
 
         return { nullptr, { import_position(r.start()), import_position(r.end()) } };
@@ -0,0 +1,180 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include "vapor/source_manager.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include <reaver/exception.h>
+
+namespace reaver::vapor
+{
+inline namespace _v1
+{
+    namespace
+    {
+        struct source_entry
+        {
+            std::optional<std::string> path;
+            std::string_view contents;
+            // only used for sources registered through register_file
+            std::string owned_contents;
+            bool on_disk = false;
+
+            std::once_flag index_flag;
+            // byte offsets of the first byte of every line
+            std::vector<std::uint32_t> line_starts;
+
+            void build_index()
+            {
+                if (on_disk)
+                {
+                    std::ifstream in{ *path, std::ios::binary };
+                    owned_contents.assign(
+                        std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{});
+                    contents = owned_contents;
+                }
+
+                line_starts.push_back(0);
+
+                auto begin = contents.data();
+                auto end = begin + contents.size();
+                for (auto it = begin; it != end;)
+                {
+                    auto newline = static_cast<const char *>(std::memchr(it, '\n', end - it));
+                    if (!newline)
+                    {
+                        break;
+                    }
+
+                    it = newline + 1;
+                    line_starts.push_back(it - begin);
+                }
+            }
+        };
+
+        class source_table
+        {
+        public:
+            file_id add(std::optional<std::string> path, std::string_view contents, bool on_disk)
+            {
+                if (contents.size() > std::numeric_limits<std::uint32_t>::max())
+                {
+                    throw exception(logger::fatal)
+                        << "source file too large: " << path.value_or("<unnamed>") << " (" << contents.size()
+                        << " bytes)";
+                }
+
+                std::unique_lock<std::shared_mutex> lock{ _mutex };
+                auto & entry = _entries.emplace_back();
+                entry.path = std::move(path);
+                entry.contents = contents;
+                entry.on_disk = on_disk;
+                return _entries.size();
+            }
+
+            source_entry * get(file_id file)
+            {
+                if (!file)
+                {
+                    return nullptr;
+                }
+
+                std::shared_lock<std::shared_mutex> lock{ _mutex };
+                assert(file <= _entries.size());
+                // deque never moves its elements, so the pointer stays valid after the lock is released
+                return &_entries[file - 1];
+            }
+
+        private:
+            std::shared_mutex _mutex;
+            std::deque<source_entry> _entries;
+        };
+
+        source_table & table()
+        {
+            static source_table instance;
+            return instance;
+        }
+    }
+
+    file_id register_source(std::optional<std::string_view> path, std::string_view contents)
+    {
+        return table().add(path ? std::make_optional(std::string{ *path }) : std::nullopt, contents, false);
+    }
+
+    file_id register_file(std::string path)
+    {
+        return table().add(std::move(path), {}, true);
+    }
+
+    std::optional<std::string_view> source_path(file_id file)
+    {
+        auto entry = table().get(file);
+        if (!entry || !entry->path)
+        {
+            return std::nullopt;
+        }
+
+        return std::string_view{ *entry->path };
+    }
+
+    line_column get_line_column(file_id file, std::uint32_t offset)
+    {
+        auto entry = table().get(file);
+        if (!entry)
+        {
+            return { 0, 0 };
+        }
+
+        std::call_once(entry->index_flag, [&] { entry->build_index(); });
+
+        auto & starts = entry->line_starts;
+        auto line = std::upper_bound(starts.begin(), starts.end(), offset) - starts.begin();
+        auto line_start = starts[line - 1];
+
+        auto begin = entry->contents.data() + line_start;
+        auto end = entry->contents.data() + std::min<std::size_t>(offset, entry->contents.size());
+
+        std::size_t column = 1;
+        for (auto it = begin; it < end; ++it)
+        {
+            // continuation bytes of multibyte sequences don't start a code point
+            if ((static_cast<unsigned char>(*it) & 0xc0) != 0x80)
+            {
+                ++column;
+            }
+        }
+
+        return { static_cast<std::size_t>(line), column };
+    }
+}
+}
@@ -36,6 +36,12 @@ options_result get_options(int argc, char ** argv)
     general.add_options()
         ("help,h", "print this message")
         ("version,v", "print version information")
+        ("jobs,j", boost::program_options::value<std::size_t>()->value_name("N")
+            ->notifier([&](auto val){
+                if (val == 0) { throw exception{ logger::error } << "-j requires at least one job"; }
+                ret->set_jobs(val);
+            }),
+            "run analysis and simplification on N threads; the output does not depend on N")
     ;
 
     boost::program_options::options_description mode("Compilation mode");
@@ -177,6 +183,9 @@ options_result get_options(int argc, char ** argv)
 
 #undef HANDLE_DIR
 
+        argv.push_back("-j");
+        argv.push_back(std::to_string(ctx.jobs()));
+
         for (auto && module_path : ctx.module_paths())
         {
             argv.push_back("-I");
@@ -22,6 +22,7 @@
 
 #include <fstream>
 
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/process.hpp>
 #include <boost/program_options/errors.hpp>
 
@@ -51,8 +52,6 @@ void run_process(const std::string & cmdline)
 int main(int argc, char ** argv)
 try
 {
-    // force a single thread of execution
-    reaver::default_executor(reaver::make_executor<reaver::thread_pool>(1));
     // reaver::logger::default_logger().set_level(reaver::logger::trace);
 
     auto [options, exit] = reaver::vapor::cli::get_options(argc, argv);
@@ -62,41 +61,46 @@ try
         return 0;
     }
 
+    // one thread of execution unless asked for more with -j
+    reaver::default_executor(reaver::make_executor<reaver::thread_pool>(options->jobs()));
+
     // compiler_options should probably expose an ifstream, or maybe just the entire
     // program buffer loaded into memory
     // but I don't know which one is better right now
     // would be useful for compiling from stdin
     assert(options->source_path());
 
-    std::ifstream input(options->source_path()->string());
-    if (!input)
+    if (!boost::filesystem::is_regular_file(*options->source_path()))
     {
         reaver::logger::dlog(reaver::logger::error) << "couldn't open the source file";
         return 1;
     }
 
-    std::string program_utf8{ std::istreambuf_iterator<char>(input.rdbuf()),
-        std::istreambuf_iterator<char>() };
-    auto program = boost::locale::conv::utf_to_utf<char32_t>(program_utf8);
+    // the source is lexed straight from the mapping; tokens are views into it, so it has to stay alive
+    // for as long as the parse tree does
+    boost::iostreams::mapped_file_source source;
+    if (boost::filesystem::file_size(*options->source_path()) != 0)
+    {
+        source.open(options->source_path()->string());
+    }
+    std::string_view program{ source.data(), source.size() };
 
     reaver::logger::dlog() << "Input:";
-    reaver::logger::dlog() << program_utf8;
+    reaver::logger::dlog() << program;
     reaver::logger::dlog();
 
     reaver::logger::dlog() << "Tokens:";
-    reaver::vapor::lexer::iterator iterator{
-        program.begin(), program.end(), options->source_path()->native()
-    };
-    for (auto it = iterator; it; ++it)
+    reaver::vapor::lexer::token_buffer tokens{ program, options->source_path()->native() };
+    for (auto && token : tokens)
     {
-        reaver::logger::dlog() << *it;
+        reaver::logger::dlog() << token;
     }
     reaver::logger::dlog();
 
     reaver::logger::default_logger().sync();
 
     reaver::logger::dlog() << "AST:";
-    auto ast = reaver::vapor::parser::parse_ast(iterator);
+    auto ast = reaver::vapor::parser::parse_ast(tokens.begin(), tokens.end(), options->jobs());
     reaver::logger::dlog() << std::ref(ast);
 
     reaver::logger::default_logger().sync();
@@ -108,6 +112,15 @@ try
 
     reaver::logger::default_logger().sync();
 
+    if (options->source_path())
+    {
+        std::ifstream cache_file{ options->evaluation_cache_path().string(), std::ios::binary };
+        if (cache_file)
+        {
+            analyzed_ast.load_evaluation_cache(cache_file);
+        }
+    }
+
     reaver::logger::dlog() << "Simplified AAST:";
     analyzed_ast.simplify();
     reaver::logger::dlog() << std::ref(analyzed_ast);
@@ -130,6 +143,12 @@ try
             return 1;
         }
         analyzed_ast.serialize_to(interface_file);
+
+        std::ofstream cache_file{ options->evaluation_cache_path().string(), std::ios::binary };
+        if (cache_file)
+        {
+            analyzed_ast.store_evaluation_cache(cache_file);
+        }
         reaver::logger::dlog() << "Done.";
     }
 
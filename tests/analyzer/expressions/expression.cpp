@@ -25,6 +25,10 @@
 #include <reaver/future_get.h>
 
 #include "../helpers.h"
+#include "vapor/analyzer/expressions/boolean.h"
+#include "vapor/analyzer/expressions/integer.h"
+#include "vapor/analyzer/expressions/pack.h"
+#include "vapor/analyzer/semantic/function.h"
 
 using namespace reaver::vapor;
 using namespace reaver::vapor::analyzer;
@@ -101,6 +105,188 @@ MAYFLY_ADD_TESTCASE("simplification", [] {
     MAYFLY_CHECK_THROWS_TYPE(unexpected_call, reaver::get(expr.simplify({ other_ctx })));
 });
 
+MAYFLY_ADD_TESTCASE("constant interning", [] {
+    boost::multiprecision::cpp_int wide_value = 1;
+    wide_value <<= 200;
+
+    auto before = interned_integer::table_size();
+
+    integer_constant one{ 1 };
+    integer_constant other_one{ 1 };
+    integer_constant two{ 2 };
+    integer_constant wide{ wide_value };
+    integer_constant other_wide{ wide_value };
+
+    // only the values that don't fit inline go into the table
+    MAYFLY_CHECK(interned_integer::table_size() == before + 1);
+
+    MAYFLY_CHECK(one.is_equal(&other_one));
+    MAYFLY_CHECK(!one.is_equal(&two));
+    MAYFLY_CHECK(wide.is_equal(&other_wide));
+    MAYFLY_CHECK(!wide.is_equal(&one));
+    MAYFLY_CHECK(one.hash_value() == other_one.hash_value());
+    MAYFLY_CHECK(wide.hash_value() == other_wide.hash_value());
+
+    replacements repl;
+    auto clone = repl.claim(&wide);
+    MAYFLY_REQUIRE(clone->as<integer_constant>());
+    MAYFLY_CHECK(clone->as<integer_constant>()->get_value() == wide_value);
+    MAYFLY_CHECK(interned_integer::table_size() == before + 1);
+});
+
+MAYFLY_ADD_TESTCASE("interned values are freed", [] {
+    auto before = interned_integer::table_size();
+
+    {
+        boost::multiprecision::cpp_int base = 1;
+        base <<= 200;
+
+        integer_constant big{ base };
+        interned_integer other{ base };
+        MAYFLY_CHECK(!other.is_small());
+        MAYFLY_CHECK(interned_integer::table_size() == before + 1);
+
+        interned_integer moved = std::move(other);
+        MAYFLY_CHECK(moved.get() == big.get_value());
+        MAYFLY_CHECK(interned_integer::table_size() == before + 1);
+
+        // a moved-from handle holds zero
+        interned_integer copy = other;
+        MAYFLY_CHECK(other.is_small() && other.get() == 0);
+        MAYFLY_CHECK(copy == interned_integer{});
+    }
+
+    MAYFLY_CHECK(interned_integer::table_size() == before);
+});
+
+MAYFLY_ADD_TESTCASE("inline integers", [] {
+    boost::multiprecision::cpp_int max = 1;
+    max <<= 127;
+    max -= 1;
+    boost::multiprecision::cpp_int min = -max - 1;
+
+    for (auto && value : { boost::multiprecision::cpp_int{ 0 },
+             boost::multiprecision::cpp_int{ -1 },
+             boost::multiprecision::cpp_int{ std::numeric_limits<std::int64_t>::min() },
+             boost::multiprecision::cpp_int{ std::numeric_limits<std::uint64_t>::max() },
+             max,
+             min })
+    {
+        auto small = to_int128(value);
+        MAYFLY_REQUIRE(small);
+        MAYFLY_CHECK(to_cpp_int(small.value()) == value);
+
+        interned_integer interned{ value };
+        MAYFLY_CHECK(interned.is_small());
+        MAYFLY_CHECK(interned.small_value() == small.value());
+        MAYFLY_CHECK(interned.get() == value);
+    }
+
+    MAYFLY_CHECK(!to_int128(max + 1));
+    MAYFLY_CHECK(!to_int128(min - 1));
+    MAYFLY_CHECK(!interned_integer{ max + 1 }.is_small());
+});
+
+MAYFLY_ADD_TESTCASE("call result cache", [] {
+    auto fn = make_function("test function");
+    integer_constant one{ 1 };
+    integer_constant other_one{ 1 };
+    integer_constant two{ 2 };
+    boolean_constant yes{ true };
+
+    MAYFLY_CHECK(hash_value(one) == hash_value(other_one));
+
+    cached_results res;
+    res.save_call_result(call_frame{ fn.get(), { &one, &yes } }, std::make_unique<integer_constant>(3));
+
+    auto hit = res.get_call_result(call_frame{ fn.get(), { &other_one, &yes } });
+    MAYFLY_REQUIRE(hit);
+    MAYFLY_REQUIRE(hit->as<integer_constant>());
+    MAYFLY_CHECK(hit->as<integer_constant>()->get_value() == 3);
+    MAYFLY_CHECK(!res.get_call_result(call_frame{ fn.get(), { &two, &yes } }));
+
+    auto stats = res.get_statistics();
+    MAYFLY_CHECK(stats.hits == 1);
+    MAYFLY_CHECK(stats.misses == 1);
+});
+
+MAYFLY_ADD_TESTCASE("call stack", [] {
+    auto fn = make_function("test function");
+    integer_constant one{ 1 };
+    integer_constant other_one{ 1 };
+    integer_constant two{ 2 };
+
+    call_stack empty;
+    auto outer = empty.push({ fn.get(), { &one } });
+    auto inner = outer.push({ fn.get(), { &two } });
+
+    MAYFLY_CHECK(empty.depth() == 0);
+    MAYFLY_CHECK(outer.depth() == 1);
+    MAYFLY_CHECK(inner.depth() == 2);
+
+    MAYFLY_CHECK(!empty.contains({ fn.get(), { &one } }));
+    MAYFLY_CHECK(outer.contains({ fn.get(), { &other_one } }));
+    MAYFLY_CHECK(!outer.contains({ fn.get(), { &two } }));
+    MAYFLY_CHECK(inner.contains({ fn.get(), { &other_one } }));
+    MAYFLY_CHECK(inner.contains({ fn.get(), { &two } }));
+});
+
+MAYFLY_ADD_TESTCASE("deep call stack", [] {
+    auto fn = make_function("test function");
+
+    std::vector<std::unique_ptr<integer_constant>> arguments;
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+        arguments.push_back(std::make_unique<integer_constant>(i));
+    }
+
+    call_stack stack;
+    call_stack halfway;
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        stack = stack.push({ fn.get(), { arguments[i].get() } });
+        if (i == 499)
+        {
+            halfway = stack;
+        }
+    }
+
+    MAYFLY_CHECK(stack.depth() == 1000);
+    MAYFLY_CHECK(halfway.depth() == 500);
+
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+        MAYFLY_CHECK(stack.contains({ fn.get(), { arguments[i].get() } }) == (i < 1000));
+        MAYFLY_CHECK(halfway.contains({ fn.get(), { arguments[i].get() } }) == (i < 500));
+    }
+});
+
+MAYFLY_ADD_TESTCASE("kind tags", [] {
+    integer_constant one{ 1 };
+    boolean_constant yes{ true };
+    test_expression other{};
+    auto pack = make_pack_expression(
+        std::vector<std::unique_ptr<expression>>{}, builtin_types().type->get_pack_type());
+
+    const statement * one_stmt = &one;
+    MAYFLY_CHECK(isa<expression>(one_stmt));
+    MAYFLY_CHECK(isa<integer_constant>(one_stmt));
+    MAYFLY_CHECK(!isa<boolean_constant>(one_stmt));
+    MAYFLY_CHECK(dyn_cast<integer_constant>(one_stmt) == &one);
+    MAYFLY_CHECK(!dyn_cast<integer_constant>(static_cast<statement *>(nullptr)));
+
+    MAYFLY_CHECK(yes.as<boolean_constant>() == &yes);
+    MAYFLY_CHECK(!yes.as<integer_constant>());
+
+    // classes without a tag of their own carry the one of their base, and fall back to dynamic_cast
+    MAYFLY_CHECK(other.get_kind() == statement::kind::expression);
+    MAYFLY_CHECK(!other.as<integer_constant>());
+    MAYFLY_CHECK(other.as<test_expression>() == &other);
+
+    MAYFLY_CHECK(pack->as<pack_expression>());
+    MAYFLY_CHECK(pack->as<owning_pack_expression>());
+});
+
 MAYFLY_END_SUITE;
 MAYFLY_END_SUITE;
 MAYFLY_END_SUITE;
@@ -0,0 +1,102 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include <reaver/future_get.h>
+#include <reaver/mayfly.h>
+
+#include "../helpers.h"
+#include "vapor/analyzer/expressions/identifier.h"
+
+using namespace reaver::vapor;
+using namespace reaver::vapor::analyzer;
+
+MAYFLY_BEGIN_SUITE("analyzer");
+MAYFLY_BEGIN_SUITE("expressions");
+MAYFLY_BEGIN_SUITE("identifier");
+
+MAYFLY_ADD_TESTCASE("resolve identifiers", [] {
+    config::compiler_options opts{ std::make_unique<config::language_options>() };
+    analysis_context ctx;
+    precontext pctx{ opts, ctx };
+
+    scope global;
+    auto local = global.clone_local();
+    auto inner = local->clone_local();
+
+    test_expression outer_expr{ builtin_types().boolean.get() };
+    test_expression local_expr{ builtin_types().boolean.get() };
+    global.init(U"outer", make_symbol(U"outer", &outer_expr));
+    local->init(U"local", make_symbol(U"local", &local_expr));
+
+    auto outer = preanalyze_identifier(
+        pctx, parse("outer", parser::parse_literal<lexer::token_type::identifier>), inner.get());
+    auto local_id = preanalyze_identifier(
+        pctx, parse("local", parser::parse_literal<lexer::token_type::identifier>), inner.get());
+    MAYFLY_CHECK(pctx.identifiers.size() == 2);
+
+    global.close();
+    resolve_identifiers(pctx);
+    MAYFLY_CHECK(pctx.identifiers.empty());
+
+    reaver::get(outer->analyze(ctx));
+    reaver::get(local_id->analyze(ctx));
+    MAYFLY_CHECK(outer->get_referenced() == &outer_expr);
+    MAYFLY_CHECK(local_id->get_referenced() == &local_expr);
+});
+
+MAYFLY_ADD_TESTCASE("resolve unknown identifier", [] {
+    config::compiler_options opts{ std::make_unique<config::language_options>() };
+    analysis_context ctx;
+    precontext pctx{ opts, ctx };
+
+    scope global;
+    auto local = global.clone_local();
+
+    auto unknown = preanalyze_identifier(
+        pctx, parse("unknown", parser::parse_literal<lexer::token_type::identifier>), local.get());
+
+    global.close();
+    MAYFLY_CHECK_THROWS_TYPE(failed_lookup, resolve_identifiers(pctx));
+});
+
+MAYFLY_ADD_TESTCASE("late identifier", [] {
+    config::compiler_options opts{ std::make_unique<config::language_options>() };
+    analysis_context ctx;
+    precontext pctx{ opts, ctx };
+
+    scope global;
+    test_expression expr{ builtin_types().boolean.get() };
+    global.init(U"late", make_symbol(U"late", &expr));
+    global.close();
+    resolve_identifiers(pctx);
+
+    auto late = preanalyze_identifier(
+        pctx, parse("late", parser::parse_literal<lexer::token_type::identifier>), &global);
+    MAYFLY_CHECK(pctx.identifiers.empty());
+
+    reaver::get(late->analyze(ctx));
+    MAYFLY_CHECK(late->get_referenced() == &expr);
+});
+
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
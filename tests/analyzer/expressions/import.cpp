@@ -0,0 +1,107 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include <reaver/mayfly.h>
+
+#include "vapor/analyzer/expressions/import.h"
+
+#include "ast.pb.h"
+#include "module.pb.h"
+
+using namespace reaver::vapor;
+using namespace reaver::vapor::analyzer;
+
+namespace
+{
+proto::module make_module(const std::vector<std::string> & names)
+{
+    proto::module ret;
+    for (auto && name : names)
+    {
+        auto entry = ret.add_symbols();
+        entry->set_name(name);
+        entry->set_entity_kind(proto::symbol_entry::kind_type);
+        entry->set_entity("entity of " + name);
+    }
+    return ret;
+}
+
+proto::module round_trip(const proto::module & module)
+{
+    proto::module ret;
+    MAYFLY_REQUIRE(ret.ParseFromString(module.SerializeAsString()));
+    return ret;
+}
+}
+
+MAYFLY_BEGIN_SUITE("analyzer");
+MAYFLY_BEGIN_SUITE("expressions");
+MAYFLY_BEGIN_SUITE("import");
+
+MAYFLY_ADD_TESTCASE("symbol directory lookup", [] {
+    std::vector<std::string> names = { "alpha", "bravo", "charlie", "delta" };
+    auto module = round_trip(make_module(names));
+
+    MAYFLY_REQUIRE(is_sorted_symbol_directory(module));
+
+    for (auto && name : names)
+    {
+        auto entry = find_symbol_entry(module, name);
+        MAYFLY_REQUIRE(entry);
+        MAYFLY_CHECK(entry->name() == name);
+        MAYFLY_CHECK(entry->entity_kind() == proto::symbol_entry::kind_type);
+        MAYFLY_CHECK(entry->entity() == "entity of " + name);
+    }
+
+    MAYFLY_CHECK(!find_symbol_entry(module, "aardvark"));
+    MAYFLY_CHECK(!find_symbol_entry(module, "bravissimo"));
+    MAYFLY_CHECK(!find_symbol_entry(module, "echo"));
+    MAYFLY_CHECK(!find_symbol_entry(proto::module{}, "alpha"));
+});
+
+MAYFLY_ADD_TESTCASE("unsorted symbol directory", [] {
+    MAYFLY_CHECK(is_sorted_symbol_directory(proto::module{}));
+    MAYFLY_CHECK(is_sorted_symbol_directory(make_module({ "alpha" })));
+    MAYFLY_CHECK(!is_sorted_symbol_directory(round_trip(make_module({ "bravo", "alpha" }))));
+    MAYFLY_CHECK(!is_sorted_symbol_directory(make_module({ "alpha", "charlie", "bravo" })));
+    MAYFLY_CHECK(!is_sorted_symbol_directory(make_module({ "alpha", "alpha" })));
+});
+
+MAYFLY_ADD_TESTCASE("interface format version", [] {
+    proto::ast unversioned;
+    MAYFLY_CHECK(unversioned.format_version() == 0);
+    MAYFLY_CHECK(!is_supported_interface(unversioned));
+
+    proto::ast current;
+    current.set_format_version(interface_format_version);
+    proto::ast parsed;
+    MAYFLY_REQUIRE(parsed.ParseFromString(current.SerializeAsString()));
+    MAYFLY_CHECK(is_supported_interface(parsed));
+
+    proto::ast newer;
+    newer.set_format_version(interface_format_version + 1);
+    MAYFLY_CHECK(!is_supported_interface(newer));
+});
+
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
@@ -44,7 +44,7 @@ MAYFLY_ADD_TESTCASE("constant construction and replacement", [] {
     initialize_global_scope(&s, keepalive);
     auto current_scope = &s;
 
-    auto type_ast = parse(UR"code(
+    auto type_ast = parse(R"code(
             struct foo
             {
                 let i : int;
@@ -54,7 +54,7 @@ MAYFLY_ADD_TESTCASE("constant construction and replacement", [] {
         parser::parse_struct_declaration);
     auto struct_decl = preanalyze_declaration(pctx, type_ast, current_scope);
 
-    auto expression_ast = parse(UR"code(
+    auto expression_ast = parse(R"code(
             let bar = foo{ 1, 2 };
         )code",
         [](auto && ctx) { return parser::parse_declaration(ctx); });
@@ -68,12 +68,9 @@ MAYFLY_ADD_TESTCASE("constant construction and replacement", [] {
     simplification_context simpl_ctx{ res };
     do
     {
-        simpl_ctx.~simplification_context();
-        new (&simpl_ctx) simplification_context(res);
-
         replace_uptr(declaration, reaver::get(declaration->simplify({ simpl_ctx })), simpl_ctx);
         reaver::get(current_scope->get(U"bar")->simplify({ simpl_ctx }));
-    } while (simpl_ctx.did_something_happen());
+    } while (simpl_ctx.next_pass());
 
     auto type_expr = struct_decl->declared_symbol()->get_expression()->as<type_expression>();
     MAYFLY_CHECK(type_expr);
@@ -97,7 +94,7 @@ MAYFLY_ADD_TESTCASE("constant construction and replacement", [] {
 
     // replacement
 
-    auto replacement_ast = parse(UR"code(
+    auto replacement_ast = parse(R"code(
             bar{ 3 }
         )code",
         [](auto && ctx) { return parser::parse_expression(ctx); });
@@ -107,11 +104,8 @@ MAYFLY_ADD_TESTCASE("constant construction and replacement", [] {
     reaver::get(replaced_expr->analyze(ctx));
     do
     {
-        simpl_ctx.~simplification_context();
-        new (&simpl_ctx) simplification_context(res);
-
         replace_uptr(replaced_expr, reaver::get(replaced_expr->simplify_expr({ simpl_ctx })), simpl_ctx);
-    } while (simpl_ctx.did_something_happen());
+    } while (simpl_ctx.next_pass());
 
     integer_constant const_three{ 3 };
 
@@ -123,7 +117,7 @@ MAYFLY_ADD_TESTCASE("constant construction and replacement", [] {
 
     // designated replacement
 
-    auto designated_repl_ast = parse(UR"code(
+    auto designated_repl_ast = parse(R"code(
                 bar{ .j = 3 }
             )code",
         [](auto && ctx) { return parser::parse_expression(ctx); });
@@ -133,12 +127,9 @@ MAYFLY_ADD_TESTCASE("constant construction and replacement", [] {
     reaver::get(designated_repl_expr->analyze(ctx));
     do
     {
-        simpl_ctx.~simplification_context();
-        new (&simpl_ctx) simplification_context(res);
-
         replace_uptr(
             designated_repl_expr, reaver::get(designated_repl_expr->simplify_expr({ simpl_ctx })), simpl_ctx);
-    } while (simpl_ctx.did_something_happen());
+    } while (simpl_ctx.next_pass());
 
     MAYFLY_CHECK(designated_repl_expr->get_type() == struct_type);
     MAYFLY_REQUIRE(designated_repl_expr->is_constant());
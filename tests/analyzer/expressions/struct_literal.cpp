@@ -44,7 +44,7 @@ MAYFLY_ADD_TESTCASE("empty struct", [] {
     initialize_global_scope(&s, keepalive);
     auto current_scope = &s;
 
-    auto ast = parse(U"struct {}", parser::parse_struct_literal);
+    auto ast = parse("struct {}", parser::parse_struct_literal);
 
     auto struct_lit = preanalyze_struct_literal(pctx, ast, current_scope);
 
@@ -77,7 +77,7 @@ MAYFLY_ADD_TESTCASE("struct with members", [] {
     initialize_global_scope(&s, keepalive);
     auto current_scope = &s;
 
-    auto ast = parse(UR"code(
+    auto ast = parse(R"code(
             struct
             {
                 let i = 1;
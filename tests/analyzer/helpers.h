@@ -32,10 +32,13 @@ namespace reaver::vapor::analyzer
 inline namespace _v1
 {
     template<typename F>
-    auto parse(std::u32string program, F && parser)
+    // the parse tree refers to the program text, so it must outlive the result; string literals do
+    auto parse(std::string_view program, F && parser)
     {
+        lexer::token_buffer tokens{ program, std::nullopt };
         parser::context ctx;
-        ctx.begin = lexer::iterator{ program.begin(), program.end(), std::nullopt };
+        ctx.begin = tokens.begin();
+        ctx.end = tokens.end();
 
         return parser(ctx);
     }
@@ -0,0 +1,68 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include <fstream>
+
+#include <reaver/mayfly.h>
+
+#include "vapor/analyzer/module_locator.h"
+
+using namespace reaver::vapor::analyzer;
+
+MAYFLY_BEGIN_SUITE("analyzer");
+MAYFLY_BEGIN_SUITE("module locator");
+
+MAYFLY_ADD_TESTCASE("finding modules", [] {
+    auto root = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%");
+    auto other_root = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%");
+    boost::filesystem::create_directories(root / "dir");
+    boost::filesystem::create_directories(other_root);
+
+    auto touch = [](const boost::filesystem::path & path) { std::ofstream{ path.string() }; };
+    touch(root / "flat.vpr");
+    touch(root / "dir" / "module.vpr");
+    touch(root / "dir" / "module.vprm");
+    touch(other_root / "other.vpr");
+
+    module_locator locator;
+    std::vector<boost::filesystem::path> roots = { root, other_root };
+
+    MAYFLY_CHECK(locator.find(roots, { "flat" }) == root / "flat.vpr");
+    MAYFLY_CHECK(locator.find(roots, { "dir" }) == root / "dir" / "module.vprm");
+    MAYFLY_CHECK(locator.find(roots, { "dir" }, true) == root / "dir" / "module.vpr");
+    MAYFLY_CHECK(locator.find(roots, { "other" }) == other_root / "other.vpr");
+    // submodules are looked for in the files of their parents
+    MAYFLY_CHECK(locator.find(roots, { "flat", "sub" }) == root / "flat.vpr");
+    MAYFLY_CHECK(!locator.find(roots, { "missing" }));
+
+    // new files are only seen after invalidation
+    touch(root / "flat.vprm");
+    MAYFLY_CHECK(locator.find(roots, { "flat" }) == root / "flat.vpr");
+    locator.invalidate();
+    MAYFLY_CHECK(locator.find(roots, { "flat" }) == root / "flat.vprm");
+
+    boost::filesystem::remove_all(root);
+    boost::filesystem::remove_all(other_root);
+});
+
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
@@ -57,6 +57,53 @@ MAYFLY_ADD_TESTCASE("init and get", [] {
     MAYFLY_REQUIRE(s.get_or_init(U"another", [&] { return std::move(another); }) == another_ptr);
 });
 
+MAYFLY_ADD_TESTCASE("lookup with unordered declarations", [] {
+    scope s{};
+
+    std::vector<std::u32string> names = { U"delta", U"alpha", U"echo", U"charlie", U"bravo" };
+    std::vector<symbol *> pointers;
+
+    for (auto && name : names)
+    {
+        auto symb = make_symbol(name);
+        pointers.push_back(symb.get());
+        MAYFLY_REQUIRE(s.init(name, std::move(symb)));
+    }
+
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+        MAYFLY_CHECK(s.get(names[i]) == pointers[i]);
+    }
+
+    MAYFLY_CHECK(!s.try_get(U"foxtrot"));
+});
+
+MAYFLY_ADD_TESTCASE("lazily materialized symbol", [] {
+    scope s{};
+
+    test_expression expr;
+    std::size_t calls = 0;
+    std::recursive_mutex lock;
+
+    auto lazy = make_symbol(U"lazy");
+    lazy->set_materializer(
+        [&]() -> expression * {
+            ++calls;
+            return &expr;
+        },
+        lock);
+    auto lazy_ptr = lazy.get();
+    s.init(U"lazy", std::move(lazy));
+
+    MAYFLY_CHECK(!lazy_ptr->is_materialized());
+    MAYFLY_CHECK(calls == 0);
+
+    MAYFLY_CHECK(s.get(U"lazy")->get_expression() == &expr);
+    MAYFLY_CHECK(lazy_ptr->get_expression() == &expr);
+    MAYFLY_CHECK(lazy_ptr->is_materialized());
+    MAYFLY_CHECK(calls == 1);
+});
+
 MAYFLY_ADD_TESTCASE("resolve", [] {
     scope parent;
     auto child = parent.clone_for_class();
@@ -0,0 +1,100 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include <reaver/mayfly.h>
+
+#include "vapor/analyzer/types/sized_arithmetic.h"
+
+using namespace reaver::vapor;
+using namespace reaver::vapor::analyzer;
+
+MAYFLY_BEGIN_SUITE("analyzer");
+MAYFLY_BEGIN_SUITE("sized arithmetic");
+
+namespace
+{
+    const sized_arithmetic::operation operations[] = { sized_arithmetic::operation::addition,
+        sized_arithmetic::operation::subtraction,
+        sized_arithmetic::operation::multiplication,
+        sized_arithmetic::operation::division };
+
+    boost::multiprecision::cpp_int reference(sized_arithmetic::operation op,
+        const boost::multiprecision::cpp_int & lhs,
+        const boost::multiprecision::cpp_int & rhs,
+        std::size_t width)
+    {
+        switch (op)
+        {
+            case sized_arithmetic::operation::addition:
+                return sized_arithmetic::wrap(lhs + rhs, width);
+            case sized_arithmetic::operation::subtraction:
+                return sized_arithmetic::wrap(lhs - rhs, width);
+            case sized_arithmetic::operation::multiplication:
+                return sized_arithmetic::wrap(lhs * rhs, width);
+            case sized_arithmetic::operation::division:
+                return sized_arithmetic::wrap(lhs / rhs, width);
+        }
+
+        assert(0);
+        return 0;
+    }
+}
+
+MAYFLY_ADD_TESTCASE("128 bit widths match cpp_int", [] {
+    for (std::size_t width : { 65, 100, 127, 128 })
+    {
+        boost::multiprecision::cpp_int max = 1;
+        max <<= width - 1;
+        max -= 1;
+        boost::multiprecision::cpp_int min = -max - 1;
+
+        std::vector<boost::multiprecision::cpp_int> operands = {
+            0, 1, -1, 3, -7, max, min, max / 3, min / 5
+        };
+
+        for (auto && lhs : operands)
+        {
+            for (auto && rhs : operands)
+            {
+                for (auto op : operations)
+                {
+                    auto result = sized_arithmetic::apply(
+                        op, to_int128(lhs).value(), to_int128(rhs).value(), width);
+
+                    if (op == sized_arithmetic::operation::division && rhs == 0)
+                    {
+                        MAYFLY_CHECK(!result);
+                        continue;
+                    }
+
+                    auto expected = reference(op, lhs, rhs, width);
+                    MAYFLY_REQUIRE(result);
+                    MAYFLY_CHECK(to_cpp_int(result.value()) == expected);
+                    MAYFLY_CHECK(sized_arithmetic::apply(op, lhs, rhs, width) == expected);
+                }
+            }
+        }
+    }
+});
+
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
@@ -0,0 +1,81 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include <fstream>
+#include <sstream>
+
+#include <reaver/mayfly.h>
+
+#include "vapor/analyzer/source_hashes.h"
+#include "vapor/sha.h"
+
+using namespace reaver::vapor;
+using namespace reaver::vapor::analyzer;
+
+MAYFLY_BEGIN_SUITE("analyzer");
+MAYFLY_BEGIN_SUITE("source hash cache");
+
+MAYFLY_ADD_TESTCASE("hashes survive a round trip and follow changes", [] {
+    auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%.vpr");
+
+    {
+        std::ofstream source{ path.string() };
+        source << "module foo {}";
+    }
+
+    source_hash_cache hashes;
+    MAYFLY_CHECK(hashes.hash(path) == sha256("module foo {}", 13));
+    MAYFLY_CHECK(hashes.last_write_time(path) > 0);
+
+    std::stringstream stored;
+    hashes.store(stored);
+
+    {
+        source_hash_cache loaded;
+        loaded.load(stored);
+        MAYFLY_CHECK(loaded.hash(path) == sha256("module foo {}", 13));
+    }
+
+    {
+        std::ofstream source{ path.string() };
+        source << "module foobar {}";
+    }
+
+    stored.clear();
+    stored.seekg(0);
+
+    source_hash_cache loaded;
+    loaded.load(stored);
+    MAYFLY_CHECK(loaded.hash(path) == sha256("module foobar {}", 16));
+
+    boost::filesystem::remove(path);
+
+    std::stringstream garbage{ "not a cache" };
+    source_hash_cache empty;
+    empty.load(garbage);
+    std::stringstream stored_empty;
+    empty.store(stored_empty);
+    MAYFLY_CHECK(stored_empty.str().empty());
+});
+
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
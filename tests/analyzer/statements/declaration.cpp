@@ -46,7 +46,7 @@ MAYFLY_ADD_TESTCASE("non-member, explicit type, initializer", [] {
         initialize_global_scope(&s1, keepalive);
         auto current_scope = &s1;
 
-        auto ast = parse(U"let foo : int = 1;",
+        auto ast = parse("let foo : int = 1;",
             [](auto && arg) { return parser::parse_declaration(arg, parser::declaration_mode::variable); });
 
         auto decl = preanalyze_declaration(pctx, ast, current_scope);
@@ -78,7 +78,7 @@ MAYFLY_ADD_TESTCASE("non-member, explicit type, initializer", [] {
         auto s2 = s1.clone_local();
         auto current_scope = s2.get();
 
-        auto ast = parse(U"let foo : int = 1;",
+        auto ast = parse("let foo : int = 1;",
             [](auto && arg) { return parser::parse_declaration(arg, parser::declaration_mode::variable); });
 
         auto decl = preanalyze_declaration(pctx, ast, current_scope);
@@ -99,7 +99,7 @@ MAYFLY_ADD_TESTCASE("non-member, deduced type, initializer", [] {
         scope s1;
         auto current_scope = &s1;
 
-        auto ast = parse(U"let foo = 1;",
+        auto ast = parse("let foo = 1;",
             [](auto && arg) { return parser::parse_declaration(arg, parser::declaration_mode::variable); });
 
         auto decl = preanalyze_declaration(pctx, ast, current_scope);
@@ -125,7 +125,7 @@ MAYFLY_ADD_TESTCASE("member, deduced type, initializer", [] {
         scope s1;
         auto current_scope = &s1;
 
-        auto ast = parse(U"let foo = 1;",
+        auto ast = parse("let foo = 1;",
             [](auto && arg) { return parser::parse_declaration(arg, parser::declaration_mode::member); });
 
         auto decl = preanalyze_member_declaration(pctx, ast, current_scope);
@@ -156,7 +156,7 @@ MAYFLY_ADD_TESTCASE("member, explicit type, no initializer", [] {
         initialize_global_scope(&s1, keepalive);
         auto current_scope = &s1;
 
-        auto ast = parse(U"let foo : int;",
+        auto ast = parse("let foo : int;",
             [](auto && arg) { return parser::parse_declaration(arg, parser::declaration_mode::member); });
 
         auto decl = preanalyze_member_declaration(pctx, ast, current_scope);
@@ -43,7 +43,7 @@ MAYFLY_ADD_TESTCASE("single branch, true", [] {
     scope s;
     auto current_scope = &s;
 
-    auto ast = parse(U"if (true) { return 1; }", parser::parse_if_statement);
+    auto ast = parse("if (true) { return 1; }", parser::parse_if_statement);
 
     std::unique_ptr<statement> if_stmt = preanalyze_if_statement(pctx, ast, current_scope);
     auto if_stmt_ptr = if_stmt.get();
@@ -74,7 +74,7 @@ MAYFLY_ADD_TESTCASE("single branch, false", [] {
     scope s;
     auto current_scope = &s;
 
-    auto ast = parse(U"if (false) { return 1; }", parser::parse_if_statement);
+    auto ast = parse("if (false) { return 1; }", parser::parse_if_statement);
 
     std::unique_ptr<statement> if_stmt = preanalyze_if_statement(pctx, ast, current_scope);
     auto if_stmt_ptr = if_stmt.get();
@@ -105,7 +105,7 @@ MAYFLY_ADD_TESTCASE("two branches, true", [] {
     scope s;
     auto current_scope = &s;
 
-    auto ast = parse(U"if (true) { return 0; } else { return 1; }", parser::parse_if_statement);
+    auto ast = parse("if (true) { return 0; } else { return 1; }", parser::parse_if_statement);
 
     std::unique_ptr<statement> if_stmt = preanalyze_if_statement(pctx, ast, current_scope);
     auto if_stmt_ptr = if_stmt.get();
@@ -138,7 +138,7 @@ MAYFLY_ADD_TESTCASE("two branches, false", [] {
     scope s;
     auto current_scope = &s;
 
-    auto ast = parse(U"if (false) { return 0; } else { return 1; }", parser::parse_if_statement);
+    auto ast = parse("if (false) { return 0; } else { return 1; }", parser::parse_if_statement);
 
     std::unique_ptr<statement> if_stmt = preanalyze_if_statement(pctx, ast, current_scope);
     auto if_stmt_ptr = if_stmt.get();
@@ -175,8 +175,8 @@ MAYFLY_ADD_TESTCASE("runtime condition", [] {
     s.init(U"condition", make_symbol(U"condition", &expr));
     s.close();
 
-    auto ast_single = parse(U"if (condition) { return 0; }", parser::parse_if_statement);
-    auto ast_double = parse(U"if (condition) { return 0; } else { return 1; }", parser::parse_if_statement);
+    auto ast_single = parse("if (condition) { return 0; }", parser::parse_if_statement);
+    auto ast_double = parse("if (condition) { return 0; } else { return 1; }", parser::parse_if_statement);
 
     auto if_stmt_single = preanalyze_if_statement(pctx, ast_single, current_scope);
     auto if_stmt_double = preanalyze_if_statement(pctx, ast_double, current_scope);
@@ -0,0 +1,268 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include <sstream>
+
+#include <reaver/mayfly.h>
+
+#include "vapor/analyzer/vm/cache.h"
+#include "vapor/analyzer/vm/interpreter.h"
+
+using namespace reaver::vapor::analyzer;
+
+MAYFLY_BEGIN_SUITE("analyzer");
+MAYFLY_BEGIN_SUITE("vm");
+
+namespace
+{
+    // f(n) = n == 0 ? 1 : n * f(n - 1), over sized integers of the given width
+    // built in place, since the function refers to itself
+    void factorial(vm::bytecode_function & fn, std::uint32_t width)
+    {
+        fn.parameter_count = 1;
+        fn.register_count = 5;
+        fn.constants = { vm::value{ std::int64_t(0) }, vm::value{ std::int64_t(1) } };
+        fn.callees = { &fn };
+        fn.code = {
+            { vm::opcode::constant, 1, 0 },
+            { vm::opcode::sized_equal_comparison, 2, 0, 1, width },
+            { vm::opcode::jump_unless, 0, 2, 5 },
+            { vm::opcode::constant, 3, 1 },
+            { vm::opcode::ret, 0, 3 },
+            { vm::opcode::constant, 3, 1 },
+            { vm::opcode::sized_subtraction, 3, 0, 3, width },
+            { vm::opcode::call, 4, 0, 3, 1 },
+            { vm::opcode::sized_multiplication, 4, 0, 4, width },
+            { vm::opcode::ret, 0, 4 },
+        };
+        fn.valid = true;
+    }
+
+    // f(n) = n < 2 ? n : f(n - 1) + f(n - 2)
+    void fibonacci(vm::bytecode_function & fn)
+    {
+        fn.parameter_count = 1;
+        fn.register_count = 9;
+        fn.constants = { vm::value{ std::int64_t(2) }, vm::value{ std::int64_t(1) } };
+        fn.callees = { &fn };
+        fn.code = {
+            { vm::opcode::constant, 1, 0 },
+            { vm::opcode::sized_less_comparison, 2, 0, 1, 62 },
+            { vm::opcode::jump_unless, 0, 2, 4 },
+            { vm::opcode::ret, 0, 0 },
+            { vm::opcode::constant, 3, 1 },
+            { vm::opcode::sized_subtraction, 4, 0, 3, 62 },
+            { vm::opcode::call, 5, 0, 4, 1 },
+            { vm::opcode::sized_subtraction, 6, 4, 3, 62 },
+            { vm::opcode::call, 7, 0, 6, 1 },
+            { vm::opcode::sized_addition, 8, 5, 7, 62 },
+            { vm::opcode::ret, 0, 8 },
+        };
+        fn.valid = true;
+    }
+}
+
+MAYFLY_ADD_TESTCASE("recursive calls", [] {
+    vm::bytecode_function fn;
+    factorial(fn, 32);
+
+    auto result = vm::run(fn, { vm::value{ std::int64_t(10) } });
+    MAYFLY_REQUIRE(result);
+    MAYFLY_REQUIRE(result->as_sized());
+    MAYFLY_CHECK(*result->as_sized() == 3628800);
+});
+
+MAYFLY_ADD_TESTCASE("sized arithmetic wraps around", [] {
+    vm::bytecode_function fn;
+    factorial(fn, 16);
+
+    auto fits = vm::run(fn, { vm::value{ std::int64_t(7) } });
+    MAYFLY_REQUIRE(fits && fits->as_sized());
+    MAYFLY_CHECK(*fits->as_sized() == 5040);
+
+    // 8! = 40320 doesn't fit in an i16
+    auto wrapped = vm::run(fn, { vm::value{ std::int64_t(8) } });
+    MAYFLY_REQUIRE(wrapped && wrapped->as_sized());
+    MAYFLY_CHECK(*wrapped->as_sized() == 40320 - 65536);
+
+    vm::bytecode_function full_width;
+    factorial(full_width, 64);
+    auto result = vm::run(full_width, { vm::value{ std::int64_t(21) } });
+    MAYFLY_REQUIRE(result && result->as_sized());
+    MAYFLY_CHECK(*result->as_sized() == static_cast<std::int64_t>(14197454024290336768ull));
+});
+
+MAYFLY_ADD_TESTCASE("limits", [] {
+    vm::bytecode_function fn;
+    factorial(fn, 32);
+
+    MAYFLY_CHECK(!vm::run(fn, { vm::value{ std::int64_t(10) } }, { 20, 64 }));
+    MAYFLY_CHECK(!vm::run(fn, { vm::value{ std::int64_t(10) } }, { 1 << 20, 4 }));
+
+    vm::bytecode_function loop;
+    loop.code = { { vm::opcode::jump, 0, 0 } };
+    loop.valid = true;
+    MAYFLY_CHECK(!vm::run(loop, {}));
+});
+
+MAYFLY_ADD_TESTCASE("hot functions are memoized", [] {
+    vm::bytecode_function fn;
+    fibonacci(fn);
+
+    auto result = vm::run(fn, { vm::value{ std::int64_t(80) } });
+    MAYFLY_REQUIRE(result);
+    MAYFLY_REQUIRE(result->as_sized());
+    MAYFLY_CHECK(*result->as_sized() == 23416728348467685);
+
+    vm::limits never_hot;
+    never_hot.hot_calls = -1;
+    never_hot.hot_steps = -1;
+    MAYFLY_CHECK(!vm::run(fn, { vm::value{ std::int64_t(80) } }, never_hot));
+
+    // memoized results must match the ones computed the slow way
+    never_hot.steps = -1;
+    for (std::int64_t n = 0; n < 20; ++n)
+    {
+        auto fast = vm::run(fn, { vm::value{ n } }, { 1 << 20, 64, 4 });
+        auto slow = vm::run(fn, { vm::value{ n } }, never_hot);
+        MAYFLY_REQUIRE(fast && slow);
+        MAYFLY_CHECK(*fast == *slow);
+    }
+});
+
+MAYFLY_ADD_TESTCASE("long calls make functions hot", [] {
+    vm::bytecode_function fn;
+    fibonacci(fn);
+
+    vm::limits long_calls;
+    long_calls.hot_calls = -1;
+    long_calls.hot_steps = 256;
+
+    auto result = vm::run(fn, { vm::value{ std::int64_t(80) } }, long_calls);
+    MAYFLY_REQUIRE(result && result->as_sized());
+    MAYFLY_CHECK(*result->as_sized() == 23416728348467685);
+});
+
+MAYFLY_ADD_TESTCASE("profiles outlive evaluations", [] {
+    vm::bytecode_function fn;
+    fibonacci(fn);
+
+    vm::limits never_hot;
+    never_hot.hot_calls = -1;
+    never_hot.hot_steps = -1;
+
+    vm::limits long_calls = never_hot;
+    long_calls.hot_steps = 256;
+
+    vm::profile profile;
+    MAYFLY_REQUIRE(vm::run(fn, { vm::value{ std::int64_t(20) } }, long_calls, &profile));
+    MAYFLY_CHECK(profile.is_hot(&fn));
+
+    // fib is already known to be hot, so this doesn't need either trigger to fire again
+    auto result = vm::run(fn, { vm::value{ std::int64_t(80) } }, never_hot, &profile);
+    MAYFLY_REQUIRE(result && result->as_sized());
+    MAYFLY_CHECK(*result->as_sized() == 23416728348467685);
+
+    // and the result itself is remembered
+    vm::limits no_steps = never_hot;
+    no_steps.steps = 0;
+    auto again = vm::run(fn, { vm::value{ std::int64_t(80) } }, no_steps, &profile);
+    MAYFLY_REQUIRE(again);
+    MAYFLY_CHECK(*again == *result);
+});
+
+MAYFLY_ADD_TESTCASE("aggregates", [] {
+    // swap(p) = { p.1, p.0 }
+    vm::bytecode_function fn;
+    fn.parameter_count = 1;
+    fn.register_count = 3;
+    fn.code = {
+        { vm::opcode::extract, 1, 0, 1 },
+        { vm::opcode::extract, 2, 0, 0 },
+        { vm::opcode::make_aggregate, 0, 1, 2 },
+        { vm::opcode::ret, 0, 0 },
+    };
+    fn.valid = true;
+
+    auto pair = std::make_shared<std::vector<vm::value>>(
+        std::vector<vm::value>{ vm::value{ std::int64_t(1) }, vm::value{ true } });
+    auto result = vm::run(fn, { vm::value{ vm::aggregate{ pair } } });
+    MAYFLY_REQUIRE(result);
+
+    auto members = result->as_aggregate();
+    MAYFLY_REQUIRE(members);
+    MAYFLY_REQUIRE((*members)->size() == 2);
+    MAYFLY_CHECK((*members)->at(0).as_boolean() && *(*members)->at(0).as_boolean());
+    MAYFLY_CHECK((*members)->at(1).as_sized() && *(*members)->at(1).as_sized() == 1);
+});
+
+MAYFLY_ADD_TESTCASE("invalid functions", [] {
+    vm::bytecode_function fn;
+    factorial(fn, 32);
+    vm::bytecode_function caller;
+    caller.parameter_count = 1;
+    caller.register_count = 2;
+    caller.callees = { &fn };
+    caller.code = { { vm::opcode::call, 1, 0, 0, 1 }, { vm::opcode::ret, 0, 1 } };
+    caller.valid = true;
+
+    MAYFLY_CHECK(vm::run(caller, { vm::value{ std::int64_t(3) } }));
+
+    fn.valid = false;
+    MAYFLY_CHECK(!vm::run(caller, { vm::value{ std::int64_t(3) } }));
+    MAYFLY_CHECK(!vm::run(fn, { vm::value{ std::int64_t(3) } }));
+});
+
+MAYFLY_ADD_TESTCASE("evaluation cache", [] {
+    vm::bytecode_function fn;
+    factorial(fn, 32);
+    vm::bytecode_function other;
+    factorial(other, 16);
+    std::vector<vm::value> arguments{ vm::value{ std::int64_t(5) } };
+
+    std::stringstream stored;
+    {
+        vm::evaluation_cache cache;
+        MAYFLY_CHECK(!cache.get(fn, arguments));
+        cache.save(fn, arguments, vm::value{ std::int64_t(120) });
+        cache.store(stored);
+    }
+
+    vm::evaluation_cache cache;
+    cache.load(stored);
+
+    auto hit = cache.get(fn, arguments);
+    MAYFLY_REQUIRE(hit);
+    MAYFLY_CHECK(*hit == vm::value{ std::int64_t(120) });
+
+    // a different width is different bytecode
+    MAYFLY_CHECK(!cache.get(other, arguments));
+    MAYFLY_CHECK(!cache.get(fn, { vm::value{ std::int64_t(6) } }));
+
+    std::stringstream garbage{ "not a cache" };
+    vm::evaluation_cache empty;
+    empty.load(garbage);
+    MAYFLY_CHECK(!empty.get(fn, arguments));
+});
+
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
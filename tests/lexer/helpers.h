@@ -25,6 +25,7 @@
 #include <reaver/mayfly.h>
 
 #include "vapor/lexer.h"
+#include "vapor/lexer/detail/scan.h"
 
 namespace reaver
 {
@@ -34,15 +35,29 @@ namespace vapor
     {
         inline namespace _v1
         {
-            auto test(std::u32string program, std::vector<token> expected)
+            inline auto test(std::string program, std::vector<token> expected)
             {
                 return [program = std::move(program), expected = std::move(expected)]() {
-                    std::vector<token> generated;
-                    std::copy(iterator{ program.begin(), program.end(), std::nullopt },
-                        iterator{},
-                        std::back_inserter(generated));
+                    auto original = selected_scanner();
 
-                    MAYFLY_REQUIRE(expected == generated);
+                    for (auto scanner : available_scanners())
+                    {
+                        select_scanner(scanner);
+
+                        std::vector<token> generated;
+                        std::copy(iterator{ program, std::nullopt },
+                            iterator{},
+                            std::back_inserter(generated));
+
+                        MAYFLY_REQUIRE(expected == generated);
+
+                        token_buffer buffer{ program, std::nullopt };
+                        std::vector<token> buffered{ buffer.begin(), buffer.end() };
+
+                        MAYFLY_REQUIRE(expected == buffered);
+                    }
+
+                    select_scanner(original);
                 };
             }
         }
@@ -0,0 +1,73 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include <reaver/mayfly.h>
+
+#include <string>
+
+#include "vapor/interned_string.h"
+#include "vapor/lexer.h"
+
+using namespace reaver::vapor;
+using namespace reaver::vapor::lexer;
+
+MAYFLY_BEGIN_SUITE("lexer");
+MAYFLY_BEGIN_SUITE("interning");
+
+MAYFLY_ADD_TESTCASE("equal strings share an entry", [] {
+    auto from_utf32 = interned_string{ U"identifier_λ" };
+    auto from_utf8 = interned_string::from_utf8(u8"identifier_λ");
+
+    MAYFLY_CHECK(from_utf32 == from_utf8);
+    MAYFLY_CHECK(from_utf32.id() == from_utf8.id());
+    MAYFLY_CHECK(from_utf32.str() == U"identifier_λ");
+    MAYFLY_CHECK(from_utf8.utf8() == u8"identifier_λ");
+    MAYFLY_CHECK(from_utf32 != interned_string{ U"identifier" });
+});
+
+MAYFLY_ADD_TESTCASE("empty string", [] {
+    auto empty = interned_string{};
+
+    MAYFLY_CHECK(empty.empty());
+    MAYFLY_CHECK(empty == interned_string{ U"" });
+    MAYFLY_CHECK(empty == interned_string::from_utf8(""));
+    MAYFLY_CHECK(empty.str().empty());
+    MAYFLY_CHECK(empty.utf8().empty());
+});
+
+MAYFLY_ADD_TESTCASE("identifier tokens", [] {
+    std::string program = "foo bar foo 123 let";
+    auto tokens = token_buffer{ program, std::nullopt };
+
+    MAYFLY_REQUIRE(tokens.size() == 5);
+    MAYFLY_CHECK(tokens[0].name == interned_string{ U"foo" });
+    MAYFLY_CHECK(tokens[1].name == interned_string{ U"bar" });
+    MAYFLY_CHECK(tokens[0].name == tokens[2].name);
+    MAYFLY_CHECK(tokens[0].name != tokens[1].name);
+
+    // only identifiers are interned
+    MAYFLY_CHECK(tokens[3].name.empty());
+    MAYFLY_CHECK(tokens[4].name.empty());
+});
+
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
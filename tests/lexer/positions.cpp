@@ -0,0 +1,69 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include <reaver/mayfly.h>
+
+#include <string>
+
+#include "vapor/lexer.h"
+
+using namespace reaver::vapor;
+using namespace reaver::vapor::lexer;
+
+MAYFLY_BEGIN_SUITE("lexer");
+MAYFLY_BEGIN_SUITE("positions");
+
+MAYFLY_ADD_TESTCASE("lines and columns", [] {
+    std::string program = u8"foo\n  λ bar\n\n// żółć\nbaz";
+    auto tokens = token_buffer{ program, std::string_view{ "positions.vp" } };
+
+    MAYFLY_REQUIRE(tokens.size() == 4);
+
+    MAYFLY_CHECK(tokens[0].range.start().line() == 1);
+    MAYFLY_CHECK(tokens[0].range.start().column() == 1);
+    MAYFLY_CHECK(tokens[0].range.end().column() == 4);
+
+    MAYFLY_CHECK(tokens[1].range.start().offset == 6);
+    MAYFLY_CHECK(tokens[1].range.start().line() == 2);
+    MAYFLY_CHECK(tokens[1].range.start().column() == 3);
+
+    // columns count code points, offsets count bytes
+    MAYFLY_CHECK(tokens[2].range.start().offset == 9);
+    MAYFLY_CHECK(tokens[2].range.start().line() == 2);
+    MAYFLY_CHECK(tokens[2].range.start().column() == 5);
+
+    MAYFLY_CHECK(tokens[3].range.start().line() == 5);
+    MAYFLY_CHECK(tokens[3].range.start().column() == 1);
+
+    MAYFLY_CHECK(tokens[3].range.start().file_path() == std::string_view{ "positions.vp" });
+});
+
+MAYFLY_ADD_TESTCASE("unknown source", [] {
+    auto pos = position{ 10 };
+
+    MAYFLY_CHECK(!pos.file_path());
+    MAYFLY_CHECK(pos.line() == 0);
+    MAYFLY_CHECK(pos.column() == 0);
+});
+
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
@@ -0,0 +1,60 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include <reaver/mayfly.h>
+
+#include <string>
+#include <vector>
+
+#include "helpers.h"
+#include "vapor/lexer.h"
+
+using namespace reaver::vapor::lexer;
+
+// the inputs here are long enough to go through the vectorized scanning loops, and not only their tails
+
+MAYFLY_BEGIN_SUITE("lexer");
+MAYFLY_BEGIN_SUITE("scanning");
+
+MAYFLY_ADD_TESTCASE("long identifier and integer",
+    test("a_very_long_identifier_that_spans_more_than_32_bytes_Of_Input0 "
+         "12345678901234567890123456789012345678",
+        { { token_type::identifier,
+              "a_very_long_identifier_that_spans_more_than_32_bytes_Of_Input0",
+              { 0, 62 } },
+            { token_type::integer, "12345678901234567890123456789012345678", { 63, 101 } } }));
+
+MAYFLY_ADD_TESTCASE("long whitespace runs",
+    test("foo                                      \n\n\t\t\t\t\r\n                                   bar",
+        { { token_type::identifier, "foo", { 0, 3 } }, { token_type::identifier, "bar", { 84, 87 } } }));
+
+MAYFLY_ADD_TESTCASE("long comments",
+    test(u8"/******************************************\n"
+         u8" * a comment header with λ and a fake end * /\n"
+         u8" ******************************************/\n"
+         u8"foo // a line comment that is longer than the vector width\n"
+         u8"bar",
+        { { token_type::identifier, "foo", { 136, 139 } },
+            { token_type::identifier, "bar", { 195, 198 } } }));
+
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
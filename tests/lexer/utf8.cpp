@@ -0,0 +1,50 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include <reaver/mayfly.h>
+
+#include <string>
+#include <vector>
+
+#include "helpers.h"
+#include "vapor/lexer.h"
+
+using namespace reaver::vapor::lexer;
+
+MAYFLY_BEGIN_SUITE("lexer");
+MAYFLY_BEGIN_SUITE("utf8");
+
+MAYFLY_ADD_TESTCASE("lambda symbol",
+    test(u8"λ(x) => x",
+        { { token_type::lambda, u8"λ", { 0, 2 } },
+            { token_type::round_bracket_open, "(", { 2, 3 } },
+            { token_type::identifier, "x", { 3, 4 } },
+            { token_type::round_bracket_close, ")", { 4, 5 } },
+            { token_type::block_value, "=>", { 6, 8 } },
+            { token_type::identifier, "x", { 9, 10 } } }));
+
+MAYFLY_ADD_TESTCASE("non-ASCII in comments and strings",
+    test(u8"/* żółć */ \"λ\" // ∀\nfoo",
+        { { token_type::string, u8"\"λ\"", { 15, 19 } }, { token_type::identifier, "foo", { 27, 30 } } }));
+
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
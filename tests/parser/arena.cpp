@@ -0,0 +1,132 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include <reaver/mayfly.h>
+
+#include "vapor/lexer.h"
+#include "vapor/parser.h"
+#include "vapor/parser/module.h"
+
+using namespace reaver::vapor;
+using namespace reaver::vapor::parser;
+
+namespace
+{
+    struct node
+    {
+        int value;
+        node_list<node_ptr<node>> children;
+    };
+
+    bool operator==(const node & lhs, const node & rhs)
+    {
+        return lhs.value == rhs.value && lhs.children == rhs.children;
+    }
+}
+
+MAYFLY_BEGIN_SUITE("parser");
+MAYFLY_BEGIN_SUITE("arena");
+
+MAYFLY_ADD_TESTCASE("scopes", [] {
+    auto & outer = current_arena();
+
+    arena first;
+    {
+        arena_scope first_scope{ first };
+        MAYFLY_CHECK(&current_arena() == &first);
+
+        arena second;
+        {
+            arena_scope second_scope{ second };
+            MAYFLY_CHECK(&current_arena() == &second);
+        }
+
+        MAYFLY_CHECK(&current_arena() == &first);
+    }
+
+    MAYFLY_CHECK(&current_arena() == &outer);
+});
+
+MAYFLY_ADD_TESTCASE("nodes live in the active arena", [] {
+    arena nodes;
+    arena_scope scope{ nodes };
+
+    node_ptr<node> root = node{ 0, {} };
+    for (int i = 1; i <= 1000; ++i)
+    {
+        root->children.push_back(node{ i, { node{ -i, {} } } });
+    }
+
+    MAYFLY_REQUIRE(root->children.size() == 1000);
+    for (int i = 0; i < 1000; ++i)
+    {
+        MAYFLY_CHECK(root->children[i]->value == i + 1);
+        MAYFLY_CHECK(root->children[i]->children.front()->value == -(i + 1));
+    }
+
+    // a few thousand nodes and the storage left behind by growing the list take a couple of blocks, not an
+    // allocation each
+    MAYFLY_CHECK(nodes.block_count() <= 2);
+});
+
+MAYFLY_ADD_TESTCASE("large allocations", [] {
+    arena nodes;
+
+    auto small = static_cast<char *>(nodes.allocate(16, 8));
+    auto large = nodes.allocate(1024 * 1024, 64);
+    auto after = static_cast<char *>(nodes.allocate(16, 8));
+
+    MAYFLY_CHECK(reinterpret_cast<std::uintptr_t>(large) % 64 == 0);
+    MAYFLY_CHECK(nodes.block_count() == 2);
+
+    // the large allocation got a block of its own and the small ones keep sharing theirs
+    MAYFLY_CHECK(after == small + 16);
+});
+
+MAYFLY_ADD_TESTCASE("copies share nodes", [] {
+    node_ptr<node> original = node{ 1, {} };
+    auto copy = original;
+
+    MAYFLY_CHECK(&copy.get() == &original.get());
+    MAYFLY_CHECK(copy == original);
+    MAYFLY_CHECK(node_ptr<node>{ node{ 1, {} } } == original);
+    MAYFLY_CHECK(node_ptr<node>{ node{ 2, {} } } != original);
+});
+
+MAYFLY_ADD_TESTCASE("parse tree", [] {
+    std::string program = "module foo { let a = 1 + 2 * 3; function f(x : int) { return x; } }";
+    lexer::token_buffer tokens{ program, std::nullopt };
+
+    auto parsed = parse_ast(tokens.begin(), tokens.end());
+
+    MAYFLY_REQUIRE(parsed.module_definitions.size() == 1);
+    MAYFLY_CHECK(parsed.module_definitions.front().statements.size() == 2);
+    MAYFLY_CHECK(parsed.nodes->block_count() == 1);
+
+    // moving the tree around doesn't move the nodes
+    auto first_statement = &parsed.module_definitions.front().statements.front();
+    auto moved = std::move(parsed);
+    MAYFLY_CHECK(&moved.module_definitions.front().statements.front() == first_statement);
+});
+
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
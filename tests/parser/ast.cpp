@@ -0,0 +1,87 @@
+/**
+ * Vapor Compiler Licence
+ *
+ * Copyright © 2019 Michał "Griwes" Dominiak
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation is required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ **/
+
+#include <reaver/mayfly.h>
+
+#include <string>
+
+#include "vapor/lexer.h"
+#include "vapor/parser.h"
+#include "vapor/parser/module.h"
+
+using namespace reaver::vapor;
+using namespace reaver::vapor::parser;
+
+namespace
+{
+    std::string generate_modules(std::size_t count)
+    {
+        std::string ret = "import foo.bar;\n";
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            auto index = std::to_string(i);
+            ret += "module m" + index + " {\n";
+            ret += "    let s = struct { let x : int; let y : int; };\n";
+            ret += "    function f(y : int) -> int\n";
+            ret += "    {\n";
+            ret += "        if (y < " + index + ") { return y * 2 + 1; }\n";
+            ret += "        return f(y - 1);\n";
+            ret += "    }\n";
+            ret += "}\n";
+        }
+
+        return ret;
+    }
+}
+
+MAYFLY_BEGIN_SUITE("parser");
+MAYFLY_BEGIN_SUITE("ast");
+
+MAYFLY_ADD_TESTCASE("parallel parse matches sequential parse", [] {
+    // large enough to be parsed in parallel
+    auto program = generate_modules(500);
+    lexer::token_buffer tokens{ program, std::nullopt };
+    MAYFLY_REQUIRE(tokens.size() > 16 * 1024);
+
+    auto sequential = parse_ast(tokens.begin(), tokens.end(), 1);
+    auto parallel = parse_ast(tokens.begin(), tokens.end(), 4);
+
+    MAYFLY_REQUIRE(parallel.global_imports.size() == 1);
+    MAYFLY_CHECK(parallel.global_imports == sequential.global_imports);
+    MAYFLY_REQUIRE(parallel.module_definitions.size() == 500);
+    MAYFLY_CHECK(parallel.module_definitions == sequential.module_definitions);
+
+    // the nodes were built in separate arenas, which now belong to the ast
+    MAYFLY_CHECK(parallel.nodes->block_count() > sequential.nodes->block_count());
+});
+
+MAYFLY_ADD_TESTCASE("parallel parse reports errors", [] {
+    auto program = generate_modules(500);
+    program += "module broken { let = 1; }\n";
+    lexer::token_buffer tokens{ program, std::nullopt };
+
+    MAYFLY_REQUIRE_THROWS_TYPE(expectation_failure, parse_ast(tokens.begin(), tokens.end(), 4));
+});
+
+MAYFLY_END_SUITE;
+MAYFLY_END_SUITE;
@@ -31,107 +31,151 @@ MAYFLY_BEGIN_SUITE("parser");
 MAYFLY_BEGIN_SUITE("binary_expression");
 
 MAYFLY_ADD_TESTCASE("simple binary-expression",
-    test(UR"(1 + 2;)",
+    test(R"(1 + 2;)",
         expression{ { 0, 5 },
             binary_expression{ { 0, 5 },
-                { lexer::token_type::plus, UR"(+)", { 2, 3 } },
+                { lexer::token_type::plus, R"(+)", { 2, 3 } },
                 { { 0, 1 },
-                    integer_literal{ { 0, 1 }, { lexer::token_type::integer, UR"(1)", { 0, 1 } }, {} } },
+                    integer_literal{ { 0, 1 }, { lexer::token_type::integer, R"(1)", { 0, 1 } }, {} } },
                 { { 4, 5 },
-                    integer_literal{ { 4, 5 }, { lexer::token_type::integer, UR"(2)", { 4, 5 } }, {} } } } },
+                    integer_literal{ { 4, 5 }, { lexer::token_type::integer, R"(2)", { 4, 5 } }, {} } } } },
         [](auto && ctx) { return parse_expression(ctx); }));
 
 MAYFLY_ADD_TESTCASE("equal precedence, left associative",
-    test(UR"(1 + 2 + 3;)",
+    test(R"(1 + 2 + 3;)",
         expression{ { 0, 9 },
             binary_expression{ { 0, 9 },
-                { lexer::token_type::plus, UR"(+)", { 6, 7 } },
+                { lexer::token_type::plus, R"(+)", { 6, 7 } },
                 { { 0, 5 },
                     binary_expression{ { 0, 5 },
-                        { lexer::token_type::plus, UR"(+)", { 2, 3 } },
+                        { lexer::token_type::plus, R"(+)", { 2, 3 } },
                         { { 0, 1 },
                             integer_literal{ { 0, 1 },
-                                { lexer::token_type::integer, UR"(1)", { 0, 1 } },
+                                { lexer::token_type::integer, R"(1)", { 0, 1 } },
                                 {} } },
                         { { 4, 5 },
                             integer_literal{ { 4, 5 },
-                                { lexer::token_type::integer, UR"(2)", { 4, 5 } },
+                                { lexer::token_type::integer, R"(2)", { 4, 5 } },
                                 {} } } } },
                 { { 8, 9 },
-                    integer_literal{ { 8, 9 }, { lexer::token_type::integer, UR"(3)", { 8, 9 } }, {} } } }
+                    integer_literal{ { 8, 9 }, { lexer::token_type::integer, R"(3)", { 8, 9 } }, {} } } }
 
         },
         [](auto && ctx) { return parse_expression(ctx); }));
 
 MAYFLY_ADD_TESTCASE("equal precedence, right associative",
-    test(UR"(1 = 2 = 3;)",
+    test(R"(1 = 2 = 3;)",
         expression{ { 0, 9 },
             binary_expression{ { 0, 9 },
-                { lexer::token_type::assign, UR"(=)", { 2, 3 } },
+                { lexer::token_type::assign, R"(=)", { 2, 3 } },
                 { { 0, 1 },
-                    integer_literal{ { 0, 1 }, { lexer::token_type::integer, UR"(1)", { 0, 1 } }, {} } },
+                    integer_literal{ { 0, 1 }, { lexer::token_type::integer, R"(1)", { 0, 1 } }, {} } },
                 { { 4, 9 },
                     binary_expression{ { 4, 9 },
-                        { lexer::token_type::assign, UR"(=)", { 6, 7 } },
+                        { lexer::token_type::assign, R"(=)", { 6, 7 } },
                         { { 4, 5 },
                             integer_literal{ { 4, 5 },
-                                { lexer::token_type::integer, UR"(2)", { 4, 5 } },
+                                { lexer::token_type::integer, R"(2)", { 4, 5 } },
                                 {} } },
                         { { 8, 9 },
                             integer_literal{ { 8, 9 },
-                                { lexer::token_type::integer, UR"(3)", { 8, 9 } },
+                                { lexer::token_type::integer, R"(3)", { 8, 9 } },
                                 {} } } } } }
 
         },
         [](auto && ctx) { return parse_expression(ctx); }));
 
 MAYFLY_ADD_TESTCASE("lower-higher precedence, left associative",
-    test(UR"(1 + 2 * 3;)",
+    test(R"(1 + 2 * 3;)",
         expression{ { 0, 9 },
             binary_expression{ { 0, 9 },
-                { lexer::token_type::plus, UR"(+)", { 2, 3 } },
+                { lexer::token_type::plus, R"(+)", { 2, 3 } },
                 { { 0, 1 },
-                    integer_literal{ { 0, 1 }, { lexer::token_type::integer, UR"(1)", { 0, 1 } }, {} } },
+                    integer_literal{ { 0, 1 }, { lexer::token_type::integer, R"(1)", { 0, 1 } }, {} } },
                 { { 4, 9 },
                     binary_expression{ { 4, 9 },
-                        { lexer::token_type::star, UR"(*)", { 6, 7 } },
+                        { lexer::token_type::star, R"(*)", { 6, 7 } },
                         { { 4, 5 },
                             integer_literal{ { 4, 5 },
-                                { lexer::token_type::integer, UR"(2)", { 4, 5 } },
+                                { lexer::token_type::integer, R"(2)", { 4, 5 } },
                                 {} } },
                         { { 8, 9 },
                             integer_literal{ { 8, 9 },
-                                { lexer::token_type::integer, UR"(3)", { 8, 9 } },
+                                { lexer::token_type::integer, R"(3)", { 8, 9 } },
                                 {} } } } } }
 
         },
         [](auto && ctx) { return parse_expression(ctx); }));
 
 MAYFLY_ADD_TESTCASE("lower-higher-lower precedence, left associative",
-    test(UR"(1 + 2 * 3 + 4;)",
+    test(R"(1 + 2 * 3 + 4;)",
         expression{ { 0, 13 },
             binary_expression{ { 0, 13 },
-                { lexer::token_type::plus, UR"(+)", { 10, 11 } },
+                { lexer::token_type::plus, R"(+)", { 10, 11 } },
                 { { 0, 9 },
                     binary_expression{ { 0, 9 },
-                        { lexer::token_type::plus, UR"(+)", { 2, 3 } },
+                        { lexer::token_type::plus, R"(+)", { 2, 3 } },
                         { { 0, 1 },
                             integer_literal{ { 0, 1 },
-                                { lexer::token_type::integer, UR"(1)", { 0, 1 } },
+                                { lexer::token_type::integer, R"(1)", { 0, 1 } },
                                 {} } },
                         { { 4, 9 },
                             binary_expression{ { 4, 9 },
-                                { lexer::token_type::star, UR"(*)", { 6, 7 } },
+                                { lexer::token_type::star, R"(*)", { 6, 7 } },
                                 { { 4, 5 },
                                     integer_literal{ { 4, 5 },
-                                        { lexer::token_type::integer, UR"(2)", { 4, 5 } },
+                                        { lexer::token_type::integer, R"(2)", { 4, 5 } },
                                         {} } },
                                 { { 8, 9 },
                                     integer_literal{ { 8, 9 },
-                                        { lexer::token_type::integer, UR"(3)", { 8, 9 } },
+                                        { lexer::token_type::integer, R"(3)", { 8, 9 } },
                                         {} } } } } } },
                 { { 12, 13 },
-                    integer_literal{ { 12, 13 }, { lexer::token_type::integer, UR"(4)", { 12, 13 } }, {} } } }
+                    integer_literal{ { 12, 13 }, { lexer::token_type::integer, R"(4)", { 12, 13 } }, {} } } }
+
+        },
+        [](auto && ctx) { return parse_expression(ctx); }));
+
+MAYFLY_ADD_TESTCASE("higher-lower precedence, left associative",
+    test(R"(1 * 2 - 3;)",
+        expression{ { 0, 9 },
+            binary_expression{ { 0, 9 },
+                { lexer::token_type::minus, R"(-)", { 6, 7 } },
+                { { 0, 5 },
+                    binary_expression{ { 0, 5 },
+                        { lexer::token_type::star, R"(*)", { 2, 3 } },
+                        { { 0, 1 },
+                            integer_literal{ { 0, 1 },
+                                { lexer::token_type::integer, R"(1)", { 0, 1 } },
+                                {} } },
+                        { { 4, 5 },
+                            integer_literal{ { 4, 5 },
+                                { lexer::token_type::integer, R"(2)", { 4, 5 } },
+                                {} } } } },
+                { { 8, 9 },
+                    integer_literal{ { 8, 9 }, { lexer::token_type::integer, R"(3)", { 8, 9 } }, {} } } }
+
+        },
+        [](auto && ctx) { return parse_expression(ctx); }));
+
+MAYFLY_ADD_TESTCASE("compound assignment, right associative",
+    test(R"(1 %= 2 += 3;)",
+        expression{ { 0, 11 },
+            binary_expression{ { 0, 11 },
+                { lexer::token_type::modulo_assignment, R"(%=)", { 2, 4 } },
+                { { 0, 1 },
+                    integer_literal{ { 0, 1 }, { lexer::token_type::integer, R"(1)", { 0, 1 } }, {} } },
+                { { 5, 11 },
+                    binary_expression{ { 5, 11 },
+                        { lexer::token_type::plus_assignment, R"(+=)", { 7, 9 } },
+                        { { 5, 6 },
+                            integer_literal{ { 5, 6 },
+                                { lexer::token_type::integer, R"(2)", { 5, 6 } },
+                                {} } },
+                        { { 10, 11 },
+                            integer_literal{ { 10, 11 },
+                                { lexer::token_type::integer, R"(3)", { 10, 11 } },
+                                {} } } } } }
 
         },
         [](auto && ctx) { return parse_expression(ctx); }));
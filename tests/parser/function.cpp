@@ -32,11 +32,11 @@ MAYFLY_BEGIN_SUITE("function");
 MAYFLY_BEGIN_SUITE("definition");
 
 MAYFLY_ADD_TESTCASE("no parameters, deduced type, simple body",
-    test(UR"(function foo() => constant;)",
+    test(R"(function foo() => constant;)",
         function_definition{ { 0, 26 },
             { { 0, 14 },
                 std::nullopt,
-                { { 9, 12 }, { lexer::token_type::identifier, UR"(foo)", { 9, 12 } } },
+                { { 9, 12 }, { lexer::token_type::identifier, R"(foo)", { 9, 12 } } },
                 {},
                 {} },
             block{ { 15, 26 },
@@ -45,23 +45,23 @@ MAYFLY_ADD_TESTCASE("no parameters, deduced type, simple body",
                     { { { 18, 26 },
                         postfix_expression{ { 18, 26 },
                             { identifier{ { 18, 26 },
-                                { lexer::token_type::identifier, UR"(constant)", { 18, 26 } } } },
+                                { lexer::token_type::identifier, R"(constant)", { 18, 26 } } } },
                             {},
                             {} } } } } } } },
         [](auto && ctx) { return parse_function_definition(ctx); }));
 
 MAYFLY_ADD_TESTCASE("no parameters, explicit type, simple body",
-    test(UR"(function foo() -> int => constant;)",
+    test(R"(function foo() -> int => constant;)",
         function_definition{ { 0, 33 },
             { { 0, 21 },
                 std::nullopt,
-                { { 9, 12 }, { lexer::token_type::identifier, UR"(foo)", { 9, 12 } } },
+                { { 9, 12 }, { lexer::token_type::identifier, R"(foo)", { 9, 12 } } },
                 {},
                 std::make_optional(expression{ { 18, 21 },
                     postfix_expression{ { 18, 21 },
                         { identifier{
                             { 18, 21 },
-                            { lexer::token_type::identifier, UR"(int)", { 18, 21 } },
+                            { lexer::token_type::identifier, R"(int)", { 18, 21 } },
                         } },
                         {},
                         {} } }) },
@@ -71,17 +71,17 @@ MAYFLY_ADD_TESTCASE("no parameters, explicit type, simple body",
                     { { { 25, 33 },
                         postfix_expression{ { 25, 33 },
                             { identifier{ { 25, 33 },
-                                { lexer::token_type::identifier, UR"(constant)", { 25, 33 } } } },
+                                { lexer::token_type::identifier, R"(constant)", { 25, 33 } } } },
                             {},
                             {} } } } } } } },
         [](auto && ctx) { return parse_function_definition(ctx); }));
 
 MAYFLY_ADD_TESTCASE("no parameters, deduced type, regular body",
-    test(UR"(function foo() { => constant })",
+    test(R"(function foo() { => constant })",
         function_definition{ { 0, 30 },
             { { 0, 14 },
                 std::nullopt,
-                { { 9, 12 }, { lexer::token_type::identifier, UR"(foo)", { 9, 12 } } },
+                { { 9, 12 }, { lexer::token_type::identifier, R"(foo)", { 9, 12 } } },
                 {},
                 {} },
             block{ { 15, 30 },
@@ -90,23 +90,23 @@ MAYFLY_ADD_TESTCASE("no parameters, deduced type, regular body",
                     { { { 20, 28 },
                         postfix_expression{ { 20, 28 },
                             { identifier{ { 20, 28 },
-                                { lexer::token_type::identifier, UR"(constant)", { 20, 28 } } } },
+                                { lexer::token_type::identifier, R"(constant)", { 20, 28 } } } },
                             {},
                             {} } } } } } } },
         [](auto && ctx) { return parse_function_definition(ctx); }));
 
 MAYFLY_ADD_TESTCASE("no parameters, explicit type, regular body",
-    test(UR"(function foo() -> int { => constant })",
+    test(R"(function foo() -> int { => constant })",
         function_definition{ { 0, 37 },
             { { 0, 21 },
                 std::nullopt,
-                { { 9, 12 }, { lexer::token_type::identifier, UR"(foo)", { 9, 12 } } },
+                { { 9, 12 }, { lexer::token_type::identifier, R"(foo)", { 9, 12 } } },
                 {},
                 std::make_optional(expression{ { 18, 21 },
                     postfix_expression{ { 18, 21 },
                         { identifier{
                             { 18, 21 },
-                            { lexer::token_type::identifier, UR"(int)", { 18, 21 } },
+                            { lexer::token_type::identifier, R"(int)", { 18, 21 } },
                         } },
                         {},
                         {} } }) },
@@ -116,24 +116,24 @@ MAYFLY_ADD_TESTCASE("no parameters, explicit type, regular body",
                     { { { 27, 35 },
                         postfix_expression{ { 27, 35 },
                             { identifier{ { 27, 35 },
-                                { lexer::token_type::identifier, UR"(constant)", { 27, 35 } } } },
+                                { lexer::token_type::identifier, R"(constant)", { 27, 35 } } } },
                             {},
                             {} } } } } } } },
         [](auto && ctx) { return parse_function_definition(ctx); }));
 
 MAYFLY_ADD_TESTCASE("one parameter, deduced type, simple body",
-    test(UR"(function foo(x : int) => constant;)",
+    test(R"(function foo(x : int) => constant;)",
         function_definition{ { 0, 33 },
             { { 0, 21 },
                 std::nullopt,
-                { { 9, 12 }, { lexer::token_type::identifier, UR"(foo)", { 9, 12 } } },
+                { { 9, 12 }, { lexer::token_type::identifier, R"(foo)", { 9, 12 } } },
                 std::make_optional(parameter_list{ { 13, 20 },
                     { parameter{ { 13, 20 },
-                        { { 13, 14 }, { lexer::token_type::identifier, UR"(x)", { 13, 14 } } },
+                        { { 13, 14 }, { lexer::token_type::identifier, R"(x)", { 13, 14 } } },
                         expression{ { 17, 20 },
                             postfix_expression{ { 17, 20 },
                                 identifier{ { 17, 20 },
-                                    { lexer::token_type::identifier, UR"(int)", { 17, 20 } } },
+                                    { lexer::token_type::identifier, R"(int)", { 17, 20 } } },
                                 {},
                                 {} } } } } }),
                 {} },
@@ -143,31 +143,31 @@ MAYFLY_ADD_TESTCASE("one parameter, deduced type, simple body",
                     { { { 25, 33 },
                         postfix_expression{ { 25, 33 },
                             { identifier{ { 25, 33 },
-                                { lexer::token_type::identifier, UR"(constant)", { 25, 33 } } } },
+                                { lexer::token_type::identifier, R"(constant)", { 25, 33 } } } },
                             {},
                             {} } } } } } } },
         [](auto && ctx) { return parse_function_definition(ctx); }));
 
 MAYFLY_ADD_TESTCASE("one parameter, explicit type, simple body",
-    test(UR"(function foo(x : int) -> int => constant;)",
+    test(R"(function foo(x : int) -> int => constant;)",
         function_definition{ { 0, 40 },
             { { 0, 28 },
                 std::nullopt,
-                { { 9, 12 }, { lexer::token_type::identifier, UR"(foo)", { 9, 12 } } },
+                { { 9, 12 }, { lexer::token_type::identifier, R"(foo)", { 9, 12 } } },
                 std::make_optional(parameter_list{ { 13, 20 },
                     { parameter{ { 13, 20 },
-                        { { 13, 14 }, { lexer::token_type::identifier, UR"(x)", { 13, 14 } } },
+                        { { 13, 14 }, { lexer::token_type::identifier, R"(x)", { 13, 14 } } },
                         expression{ { 17, 20 },
                             postfix_expression{ { 17, 20 },
                                 identifier{ { 17, 20 },
-                                    { lexer::token_type::identifier, UR"(int)", { 17, 20 } } },
+                                    { lexer::token_type::identifier, R"(int)", { 17, 20 } } },
                                 {},
                                 {} } } } } }),
                 std::make_optional(expression{ { 25, 28 },
                     postfix_expression{ { 25, 28 },
                         { identifier{
                             { 25, 28 },
-                            { lexer::token_type::identifier, UR"(int)", { 25, 28 } },
+                            { lexer::token_type::identifier, R"(int)", { 25, 28 } },
                         } },
                         {},
                         {} } }) },
@@ -177,32 +177,32 @@ MAYFLY_ADD_TESTCASE("one parameter, explicit type, simple body",
                     { { { 32, 40 },
                         postfix_expression{ { 32, 40 },
                             { identifier{ { 32, 40 },
-                                { lexer::token_type::identifier, UR"(constant)", { 32, 40 } } } },
+                                { lexer::token_type::identifier, R"(constant)", { 32, 40 } } } },
                             {},
                             {} } } } } } } },
         [](auto && ctx) { return parse_function_definition(ctx); }));
 
 MAYFLY_ADD_TESTCASE("two parameters, deduced type, simple body",
-    test(UR"(function foo(x : int, y : bool) => constant;)",
+    test(R"(function foo(x : int, y : bool) => constant;)",
         function_definition{ { 0, 43 },
             { { 0, 31 },
                 std::nullopt,
-                { { 9, 12 }, { lexer::token_type::identifier, UR"(foo)", { 9, 12 } } },
+                { { 9, 12 }, { lexer::token_type::identifier, R"(foo)", { 9, 12 } } },
                 std::make_optional(parameter_list{ { 13, 30 },
                     { parameter{ { 13, 20 },
-                          { { 13, 14 }, { lexer::token_type::identifier, UR"(x)", { 13, 14 } } },
+                          { { 13, 14 }, { lexer::token_type::identifier, R"(x)", { 13, 14 } } },
                           expression{ { 17, 20 },
                               postfix_expression{ { 17, 20 },
                                   identifier{ { 17, 20 },
-                                      { lexer::token_type::identifier, UR"(int)", { 17, 20 } } },
+                                      { lexer::token_type::identifier, R"(int)", { 17, 20 } } },
                                   {},
                                   {} } } },
                         parameter{ { 22, 30 },
-                            { { 22, 23 }, { lexer::token_type::identifier, UR"(y)", { 22, 23 } } },
+                            { { 22, 23 }, { lexer::token_type::identifier, R"(y)", { 22, 23 } } },
                             expression{ { 26, 30 },
                                 postfix_expression{ { 26, 30 },
                                     identifier{ { 26, 30 },
-                                        { lexer::token_type::identifier, UR"(bool)", { 26, 30 } } },
+                                        { lexer::token_type::identifier, R"(bool)", { 26, 30 } } },
                                     {},
                                     {} } } } } }),
                 {} },
@@ -212,39 +212,39 @@ MAYFLY_ADD_TESTCASE("two parameters, deduced type, simple body",
                     { { { 35, 43 },
                         postfix_expression{ { 35, 43 },
                             { identifier{ { 35, 43 },
-                                { lexer::token_type::identifier, UR"(constant)", { 35, 43 } } } },
+                                { lexer::token_type::identifier, R"(constant)", { 35, 43 } } } },
                             {},
                             {} } } } } } } },
         [](auto && ctx) { return parse_function_definition(ctx); }));
 
 MAYFLY_ADD_TESTCASE("two parameters, explicit type, simple body",
-    test(UR"(function foo(x : int, y : bool) -> int => constant;)",
+    test(R"(function foo(x : int, y : bool) -> int => constant;)",
         function_definition{ { 0, 50 },
             { { 0, 38 },
                 std::nullopt,
-                { { 9, 12 }, { lexer::token_type::identifier, UR"(foo)", { 9, 12 } } },
+                { { 9, 12 }, { lexer::token_type::identifier, R"(foo)", { 9, 12 } } },
                 std::make_optional(parameter_list{ { 13, 30 },
                     { parameter{ { 13, 20 },
-                          { { 13, 14 }, { lexer::token_type::identifier, UR"(x)", { 13, 14 } } },
+                          { { 13, 14 }, { lexer::token_type::identifier, R"(x)", { 13, 14 } } },
                           expression{ { 17, 20 },
                               postfix_expression{ { 17, 20 },
                                   identifier{ { 17, 20 },
-                                      { lexer::token_type::identifier, UR"(int)", { 17, 20 } } },
+                                      { lexer::token_type::identifier, R"(int)", { 17, 20 } } },
                                   {},
                                   {} } } },
                         parameter{ { 22, 30 },
-                            { { 22, 23 }, { lexer::token_type::identifier, UR"(y)", { 22, 23 } } },
+                            { { 22, 23 }, { lexer::token_type::identifier, R"(y)", { 22, 23 } } },
                             expression{ { 26, 30 },
                                 postfix_expression{ { 26, 30 },
                                     identifier{ { 26, 30 },
-                                        { lexer::token_type::identifier, UR"(bool)", { 26, 30 } } },
+                                        { lexer::token_type::identifier, R"(bool)", { 26, 30 } } },
                                     {},
                                     {} } } } } }),
                 std::make_optional(expression{ { 35, 38 },
                     postfix_expression{ { 35, 38 },
                         { identifier{
                             { 35, 38 },
-                            { lexer::token_type::identifier, UR"(int)", { 35, 38 } },
+                            { lexer::token_type::identifier, R"(int)", { 35, 38 } },
                         } },
                         {},
                         {} } }) },
@@ -254,7 +254,7 @@ MAYFLY_ADD_TESTCASE("two parameters, explicit type, simple body",
                     { { { 42, 50 },
                         postfix_expression{ { 42, 50 },
                             { identifier{ { 42, 50 },
-                                { lexer::token_type::identifier, UR"(constant)", { 42, 50 } } } },
+                                { lexer::token_type::identifier, R"(constant)", { 42, 50 } } } },
                             {},
                             {} } } } } } } },
         [](auto && ctx) { return parse_function_definition(ctx); }));
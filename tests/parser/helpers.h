@@ -53,13 +53,15 @@ namespace vapor
             }
 
             template<typename T, typename F>
-            auto test(std::u32string program, T expected, F && parser)
+            auto test(std::string program, T expected, F && parser)
             {
                 return [program = std::move(program),
                            expected = std::move(expected),
                            parser = std::move(parser)]() {
+                    lexer::token_buffer tokens{ program, std::nullopt };
                     context ctx;
-                    ctx.begin = lexer::iterator{ program.begin(), program.end(), std::nullopt };
+                    ctx.begin = tokens.begin();
+                    ctx.end = tokens.end();
 
                     std::stringstream ss;
                     for (auto it = ctx.begin; it != ctx.end; ++it)
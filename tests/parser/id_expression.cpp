@@ -31,20 +31,20 @@ MAYFLY_BEGIN_SUITE("parser");
 MAYFLY_BEGIN_SUITE("id_expression");
 
 MAYFLY_ADD_TESTCASE("simple id-expression",
-    test(UR"(foo)",
+    test(R"(foo)",
         id_expression{ { 0, 3 },
-            { identifier{ { 0, 3 }, { lexer::token_type::identifier, UR"(foo)", { 0, 3 } } } } },
+            { identifier{ { 0, 3 }, { lexer::token_type::identifier, R"(foo)", { 0, 3 } } } } },
         &parse_id_expression));
 
 MAYFLY_ADD_TESTCASE("complex id-expression",
-    test(UR"(foo.bar.baz)",
+    test(R"(foo.bar.baz)",
         id_expression{ { 0, 11 },
-            { identifier{ { 0, 3 }, { lexer::token_type::identifier, UR"(foo)", { 0, 3 } } },
-                identifier{ { 4, 7 }, { lexer::token_type::identifier, UR"(bar)", { 4, 7 } } },
-                identifier{ { 8, 11 }, { lexer::token_type::identifier, UR"(baz)", { 8, 11 } } } } },
+            { identifier{ { 0, 3 }, { lexer::token_type::identifier, R"(foo)", { 0, 3 } } },
+                identifier{ { 4, 7 }, { lexer::token_type::identifier, R"(bar)", { 4, 7 } } },
+                identifier{ { 8, 11 }, { lexer::token_type::identifier, R"(baz)", { 8, 11 } } } } },
         &parse_id_expression));
 
-MAYFLY_ADD_TESTCASE("invalid id-expression", test(UR"(.foo.bar)", 0, [](auto && ctx) {
+MAYFLY_ADD_TESTCASE("invalid id-expression", test(R"(.foo.bar)", 0, [](auto && ctx) {
     MAYFLY_REQUIRE_THROWS_TYPE(expectation_failure, parse_id_expression(ctx));
     return 0;
 }));
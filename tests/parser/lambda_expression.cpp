@@ -31,209 +31,209 @@ MAYFLY_BEGIN_SUITE("parser");
 MAYFLY_BEGIN_SUITE("lambda_expression");
 
 MAYFLY_ADD_TESTCASE("no parameters, deduced type, simple body",
-    test(UR"(λ => constant;)",
-        lambda_expression{ { 0, 13 },
+    test(R"(λ => constant;)",
+        lambda_expression{ { 0, 14 },
             {},
             {},
             {},
-            block{ { 2, 13 },
+            block{ { 3, 14 },
                 {},
-                { expression_list{ { 5, 13 },
-                    { { { 5, 13 },
-                        postfix_expression{ { 5, 13 },
-                            { identifier{ { 5, 13 },
-                                { lexer::token_type::identifier, UR"(constant)", { 5, 13 } } } },
+                { expression_list{ { 6, 14 },
+                    { { { 6, 14 },
+                        postfix_expression{ { 6, 14 },
+                            { identifier{ { 6, 14 },
+                                { lexer::token_type::identifier, R"(constant)", { 6, 14 } } } },
                             {},
                             {} } } } } } } },
         &parse_lambda_expression));
 
 MAYFLY_ADD_TESTCASE("no parameters, explicit type, simple body",
-    test(UR"(λ -> int => constant;)",
-        lambda_expression{ { 0, 20 },
+    test(R"(λ -> int => constant;)",
+        lambda_expression{ { 0, 21 },
             {},
             {},
-            std::make_optional(expression{ { 5, 8 },
-                postfix_expression{ { 5, 8 },
+            std::make_optional(expression{ { 6, 9 },
+                postfix_expression{ { 6, 9 },
                     { identifier{
-                        { 5, 8 },
-                        { lexer::token_type::identifier, UR"(int)", { 5, 8 } },
+                        { 6, 9 },
+                        { lexer::token_type::identifier, R"(int)", { 6, 9 } },
                     } },
                     {},
                     {} } }),
-            block{ { 9, 20 },
+            block{ { 10, 21 },
                 {},
-                { expression_list{ { 12, 20 },
-                    { { { 12, 20 },
-                        postfix_expression{ { 12, 20 },
-                            { identifier{ { 12, 20 },
-                                { lexer::token_type::identifier, UR"(constant)", { 12, 20 } } } },
+                { expression_list{ { 13, 21 },
+                    { { { 13, 21 },
+                        postfix_expression{ { 13, 21 },
+                            { identifier{ { 13, 21 },
+                                { lexer::token_type::identifier, R"(constant)", { 13, 21 } } } },
                             {},
                             {} } } } } } } },
         &parse_lambda_expression));
 
 MAYFLY_ADD_TESTCASE("no parameters, deduced type, regular body",
-    test(UR"(λ { => constant })",
-        lambda_expression{ { 0, 17 },
+    test(R"(λ { => constant })",
+        lambda_expression{ { 0, 18 },
             {},
             {},
             {},
-            block{ { 2, 17 },
+            block{ { 3, 18 },
                 {},
-                { expression_list{ { 7, 15 },
-                    { { { 7, 15 },
-                        postfix_expression{ { 7, 15 },
-                            { identifier{ { 7, 15 },
-                                { lexer::token_type::identifier, UR"(constant)", { 7, 15 } } } },
+                { expression_list{ { 8, 16 },
+                    { { { 8, 16 },
+                        postfix_expression{ { 8, 16 },
+                            { identifier{ { 8, 16 },
+                                { lexer::token_type::identifier, R"(constant)", { 8, 16 } } } },
                             {},
                             {} } } } } } } },
         &parse_lambda_expression));
 
 MAYFLY_ADD_TESTCASE("no parameters, explicit type, regular body",
-    test(UR"(λ -> int { => constant })",
-        lambda_expression{ { 0, 24 },
+    test(R"(λ -> int { => constant })",
+        lambda_expression{ { 0, 25 },
             {},
             {},
-            std::make_optional(expression{ { 5, 8 },
-                postfix_expression{ { 5, 8 },
+            std::make_optional(expression{ { 6, 9 },
+                postfix_expression{ { 6, 9 },
                     { identifier{
-                        { 5, 8 },
-                        { lexer::token_type::identifier, UR"(int)", { 5, 8 } },
+                        { 6, 9 },
+                        { lexer::token_type::identifier, R"(int)", { 6, 9 } },
                     } },
                     {},
                     {} } }),
-            block{ { 9, 24 },
+            block{ { 10, 25 },
                 {},
-                { expression_list{ { 14, 22 },
-                    { { { 14, 22 },
-                        postfix_expression{ { 14, 22 },
-                            { identifier{ { 14, 22 },
-                                { lexer::token_type::identifier, UR"(constant)", { 14, 22 } } } },
+                { expression_list{ { 15, 23 },
+                    { { { 15, 23 },
+                        postfix_expression{ { 15, 23 },
+                            { identifier{ { 15, 23 },
+                                { lexer::token_type::identifier, R"(constant)", { 15, 23 } } } },
                             {},
                             {} } } } } } } },
         &parse_lambda_expression));
 
 MAYFLY_ADD_TESTCASE("one parameter, deduced type, simple body",
-    test(UR"(λ(x : int) => constant;)",
-        lambda_expression{ { 0, 22 },
-            {},
-            std::make_optional(parameter_list{ { 2, 9 },
-                { parameter{ { 2, 9 },
-                    { { 2, 3 }, { lexer::token_type::identifier, UR"(x)", { 2, 3 } } },
-                    expression{ { 6, 9 },
-                        postfix_expression{ { 6, 9 },
-                            identifier{ { 6, 9 }, { lexer::token_type::identifier, UR"(int)", { 6, 9 } } },
+    test(R"(λ(x : int) => constant;)",
+        lambda_expression{ { 0, 23 },
+            {},
+            std::make_optional(parameter_list{ { 3, 10 },
+                { parameter{ { 3, 10 },
+                    { { 3, 4 }, { lexer::token_type::identifier, R"(x)", { 3, 4 } } },
+                    expression{ { 7, 10 },
+                        postfix_expression{ { 7, 10 },
+                            identifier{ { 7, 10 }, { lexer::token_type::identifier, R"(int)", { 7, 10 } } },
                             {},
                             {} } } } } }),
             {},
-            block{ { 11, 22 },
+            block{ { 12, 23 },
                 {},
-                { expression_list{ { 14, 22 },
-                    { { { 14, 22 },
-                        postfix_expression{ { 14, 22 },
-                            { identifier{ { 14, 22 },
-                                { lexer::token_type::identifier, UR"(constant)", { 14, 22 } } } },
+                { expression_list{ { 15, 23 },
+                    { { { 15, 23 },
+                        postfix_expression{ { 15, 23 },
+                            { identifier{ { 15, 23 },
+                                { lexer::token_type::identifier, R"(constant)", { 15, 23 } } } },
                             {},
                             {} } } } } } } },
         &parse_lambda_expression));
 
 MAYFLY_ADD_TESTCASE("one parameter, explicit type, simple body",
-    test(UR"(λ(x : int) -> int => constant;)",
-        lambda_expression{ { 0, 29 },
-            {},
-            std::make_optional(parameter_list{ { 2, 9 },
-                { parameter{ { 2, 9 },
-                    { { 2, 3 }, { lexer::token_type::identifier, UR"(x)", { 2, 3 } } },
-                    expression{ { 6, 9 },
-                        postfix_expression{ { 6, 9 },
-                            identifier{ { 6, 9 }, { lexer::token_type::identifier, UR"(int)", { 6, 9 } } },
+    test(R"(λ(x : int) -> int => constant;)",
+        lambda_expression{ { 0, 30 },
+            {},
+            std::make_optional(parameter_list{ { 3, 10 },
+                { parameter{ { 3, 10 },
+                    { { 3, 4 }, { lexer::token_type::identifier, R"(x)", { 3, 4 } } },
+                    expression{ { 7, 10 },
+                        postfix_expression{ { 7, 10 },
+                            identifier{ { 7, 10 }, { lexer::token_type::identifier, R"(int)", { 7, 10 } } },
                             {},
                             {} } } } } }),
-            std::make_optional(expression{ { 14, 17 },
-                postfix_expression{ { 14, 17 },
+            std::make_optional(expression{ { 15, 18 },
+                postfix_expression{ { 15, 18 },
                     { identifier{
-                        { 14, 17 },
-                        { lexer::token_type::identifier, UR"(int)", { 14, 17 } },
+                        { 15, 18 },
+                        { lexer::token_type::identifier, R"(int)", { 15, 18 } },
                     } },
                     {},
                     {} } }),
-            block{ { 18, 29 },
+            block{ { 19, 30 },
                 {},
-                { expression_list{ { 21, 29 },
-                    { { { 21, 29 },
-                        postfix_expression{ { 21, 29 },
-                            { identifier{ { 21, 29 },
-                                { lexer::token_type::identifier, UR"(constant)", { 21, 29 } } } },
+                { expression_list{ { 22, 30 },
+                    { { { 22, 30 },
+                        postfix_expression{ { 22, 30 },
+                            { identifier{ { 22, 30 },
+                                { lexer::token_type::identifier, R"(constant)", { 22, 30 } } } },
                             {},
                             {} } } } } } } },
         &parse_lambda_expression));
 
 MAYFLY_ADD_TESTCASE("two parameters, deduced type, simple body",
-    test(UR"(λ(x : int, y : bool) => constant;)",
-        lambda_expression{ { 0, 32 },
-            {},
-            std::make_optional(parameter_list{ { 2, 19 },
-                { parameter{ { 2, 9 },
-                      { { 2, 3 }, { lexer::token_type::identifier, UR"(x)", { 2, 3 } } },
-                      expression{ { 6, 9 },
-                          postfix_expression{ { 6, 9 },
-                              identifier{ { 6, 9 }, { lexer::token_type::identifier, UR"(int)", { 6, 9 } } },
+    test(R"(λ(x : int, y : bool) => constant;)",
+        lambda_expression{ { 0, 33 },
+            {},
+            std::make_optional(parameter_list{ { 3, 20 },
+                { parameter{ { 3, 10 },
+                      { { 3, 4 }, { lexer::token_type::identifier, R"(x)", { 3, 4 } } },
+                      expression{ { 7, 10 },
+                          postfix_expression{ { 7, 10 },
+                              identifier{ { 7, 10 }, { lexer::token_type::identifier, R"(int)", { 7, 10 } } },
                               {},
                               {} } } },
-                    parameter{ { 11, 19 },
-                        { { 11, 12 }, { lexer::token_type::identifier, UR"(y)", { 11, 12 } } },
-                        expression{ { 15, 19 },
-                            postfix_expression{ { 15, 19 },
-                                identifier{ { 15, 19 },
-                                    { lexer::token_type::identifier, UR"(bool)", { 15, 19 } } },
+                    parameter{ { 12, 20 },
+                        { { 12, 13 }, { lexer::token_type::identifier, R"(y)", { 12, 13 } } },
+                        expression{ { 16, 20 },
+                            postfix_expression{ { 16, 20 },
+                                identifier{ { 16, 20 },
+                                    { lexer::token_type::identifier, R"(bool)", { 16, 20 } } },
                                 {},
                                 {} } } } } }),
             {},
-            block{ { 21, 32 },
+            block{ { 22, 33 },
                 {},
-                { expression_list{ { 24, 32 },
-                    { { { 24, 32 },
-                        postfix_expression{ { 24, 32 },
-                            { identifier{ { 24, 32 },
-                                { lexer::token_type::identifier, UR"(constant)", { 24, 32 } } } },
+                { expression_list{ { 25, 33 },
+                    { { { 25, 33 },
+                        postfix_expression{ { 25, 33 },
+                            { identifier{ { 25, 33 },
+                                { lexer::token_type::identifier, R"(constant)", { 25, 33 } } } },
                             {},
                             {} } } } } } } },
         &parse_lambda_expression));
 
 MAYFLY_ADD_TESTCASE("two parameters, explicit type, simple body",
-    test(UR"(λ(x : int, y : bool) -> int => constant;)",
-        lambda_expression{ { 0, 39 },
-            {},
-            std::make_optional(parameter_list{ { 2, 19 },
-                { parameter{ { 2, 9 },
-                      { { 2, 3 }, { lexer::token_type::identifier, UR"(x)", { 2, 3 } } },
-                      expression{ { 6, 9 },
-                          postfix_expression{ { 6, 9 },
-                              identifier{ { 6, 9 }, { lexer::token_type::identifier, UR"(int)", { 6, 9 } } },
+    test(R"(λ(x : int, y : bool) -> int => constant;)",
+        lambda_expression{ { 0, 40 },
+            {},
+            std::make_optional(parameter_list{ { 3, 20 },
+                { parameter{ { 3, 10 },
+                      { { 3, 4 }, { lexer::token_type::identifier, R"(x)", { 3, 4 } } },
+                      expression{ { 7, 10 },
+                          postfix_expression{ { 7, 10 },
+                              identifier{ { 7, 10 }, { lexer::token_type::identifier, R"(int)", { 7, 10 } } },
                               {},
                               {} } } },
-                    parameter{ { 11, 19 },
-                        { { 11, 12 }, { lexer::token_type::identifier, UR"(y)", { 11, 12 } } },
-                        expression{ { 15, 19 },
-                            postfix_expression{ { 15, 19 },
-                                identifier{ { 15, 19 },
-                                    { lexer::token_type::identifier, UR"(bool)", { 15, 19 } } },
+                    parameter{ { 12, 20 },
+                        { { 12, 13 }, { lexer::token_type::identifier, R"(y)", { 12, 13 } } },
+                        expression{ { 16, 20 },
+                            postfix_expression{ { 16, 20 },
+                                identifier{ { 16, 20 },
+                                    { lexer::token_type::identifier, R"(bool)", { 16, 20 } } },
                                 {},
                                 {} } } } } }),
-            std::make_optional(expression{ { 24, 27 },
-                postfix_expression{ { 24, 27 },
+            std::make_optional(expression{ { 25, 28 },
+                postfix_expression{ { 25, 28 },
                     { identifier{
-                        { 24, 27 },
-                        { lexer::token_type::identifier, UR"(int)", { 24, 27 } },
+                        { 25, 28 },
+                        { lexer::token_type::identifier, R"(int)", { 25, 28 } },
                     } },
                     {},
                     {} } }),
-            block{ { 28, 39 },
+            block{ { 29, 40 },
                 {},
-                { expression_list{ { 31, 39 },
-                    { { { 31, 39 },
-                        postfix_expression{ { 31, 39 },
-                            { identifier{ { 31, 39 },
-                                { lexer::token_type::identifier, UR"(constant)", { 31, 39 } } } },
+                { expression_list{ { 32, 40 },
+                    { { { 32, 40 },
+                        postfix_expression{ { 32, 40 },
+                            { identifier{ { 32, 40 },
+                                { lexer::token_type::identifier, R"(constant)", { 32, 40 } } } },
                             {},
                             {} } } } } } } },
         &parse_lambda_expression));
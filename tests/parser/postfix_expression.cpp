@@ -31,28 +31,28 @@ MAYFLY_BEGIN_SUITE("parser");
 MAYFLY_BEGIN_SUITE("postfix_expression");
 
 MAYFLY_ADD_TESTCASE("basic postfix-expression",
-    test(UR"(foo;)",
+    test(R"(foo;)",
         postfix_expression{ { 0, 3 },
-            identifier{ { 0, 3 }, { lexer::token_type::identifier, UR"(foo)", { 0, 3 } } },
+            identifier{ { 0, 3 }, { lexer::token_type::identifier, R"(foo)", { 0, 3 } } },
             {},
             {} },
         [](auto && ctx) { return parse_postfix_expression(ctx); }));
 
 MAYFLY_ADD_TESTCASE("argumentless",
-    test(UR"(foo();)",
+    test(R"(foo();)",
         postfix_expression{ { 0, 5 },
-            identifier{ { 0, 3 }, { lexer::token_type::identifier, UR"(foo)", { 0, 3 } } },
+            identifier{ { 0, 3 }, { lexer::token_type::identifier, R"(foo)", { 0, 3 } } },
             lexer::token_type::round_bracket_open,
             {} },
         [](auto && ctx) { return parse_postfix_expression(ctx); }));
 
 MAYFLY_ADD_TESTCASE("chained argumentless",
-    test(UR"(foo()();)",
+    test(R"(foo()();)",
         postfix_expression{ { 0, 7 },
             expression_list{ { 0, 5 },
                 { expression{ { 0, 5 },
                     postfix_expression{ { 0, 5 },
-                        identifier{ { 0, 3 }, { lexer::token_type::identifier, UR"(foo)", { 0, 3 } } },
+                        identifier{ { 0, 3 }, { lexer::token_type::identifier, R"(foo)", { 0, 3 } } },
                         lexer::token_type::round_bracket_open,
                         {} } } } },
             lexer::token_type::round_bracket_open,
@@ -60,32 +60,32 @@ MAYFLY_ADD_TESTCASE("chained argumentless",
         [](auto && ctx) { return parse_postfix_expression(ctx); }));
 
 MAYFLY_ADD_TESTCASE("one argument",
-    test(UR"(foo[1];)",
+    test(R"(foo[1];)",
         postfix_expression{ { 0, 6 },
-            identifier{ { 0, 3 }, { lexer::token_type::identifier, UR"(foo)", { 0, 3 } } },
+            identifier{ { 0, 3 }, { lexer::token_type::identifier, R"(foo)", { 0, 3 } } },
             lexer::token_type::square_bracket_open,
             { { { 4, 5 },
-                integer_literal{ { 4, 5 }, { lexer::token_type::integer, UR"(1)", { 4, 5 } }, {} } } } },
+                integer_literal{ { 4, 5 }, { lexer::token_type::integer, R"(1)", { 4, 5 } }, {} } } } },
         [](auto && ctx) { return parse_postfix_expression(ctx); }));
 
 MAYFLY_ADD_TESTCASE("more arguments",
-    test(UR"(foo{ a, b, c };)",
+    test(R"(foo{ a, b, c };)",
         postfix_expression{ { 0, 14 },
-            identifier{ { 0, 3 }, { lexer::token_type::identifier, UR"(foo)", { 0, 3 } } },
+            identifier{ { 0, 3 }, { lexer::token_type::identifier, R"(foo)", { 0, 3 } } },
             lexer::token_type::curly_bracket_open,
             { { { 5, 6 },
                   postfix_expression{ { 5, 6 },
-                      identifier{ { 5, 6 }, { lexer::token_type::identifier, UR"(a)", { 5, 6 } } },
+                      identifier{ { 5, 6 }, { lexer::token_type::identifier, R"(a)", { 5, 6 } } },
                       {},
                       {} } },
                 { { 8, 9 },
                     postfix_expression{ { 8, 9 },
-                        identifier{ { 8, 9 }, { lexer::token_type::identifier, UR"(b)", { 8, 9 } } },
+                        identifier{ { 8, 9 }, { lexer::token_type::identifier, R"(b)", { 8, 9 } } },
                         {},
                         {} } },
                 { { 11, 12 },
                     postfix_expression{ { 11, 12 },
-                        identifier{ { 11, 12 }, { lexer::token_type::identifier, UR"(c)", { 11, 12 } } },
+                        identifier{ { 11, 12 }, { lexer::token_type::identifier, R"(c)", { 11, 12 } } },
                         {},
                         {} } } } },
         [](auto && ctx) { return parse_postfix_expression(ctx); }));
@@ -31,98 +31,98 @@ MAYFLY_BEGIN_SUITE("parser");
 MAYFLY_BEGIN_SUITE("struct");
 
 MAYFLY_ADD_TESTCASE("empty literal",
-    test(UR"(struct {};)", struct_literal{ { 0, 9 }, {} }, &parse_struct_literal));
+    test(R"(struct {};)", struct_literal{ { 0, 9 }, {} }, &parse_struct_literal));
 
 MAYFLY_ADD_TESTCASE("single member literal",
-    test(UR"(struct { let i : int; };)",
+    test(R"(struct { let i : int; };)",
         struct_literal{ { 0, 23 },
             { { declaration{ { 9, 20 },
                 std::nullopt,
-                { { 13, 14 }, { lexer::token_type::identifier, UR"(i)", { 13, 14 } } },
+                { { 13, 14 }, { lexer::token_type::identifier, R"(i)", { 13, 14 } } },
                 std::make_optional<expression>({ { 17, 20 },
                     postfix_expression{ { 17, 20 },
-                        identifier{ { 17, 20 }, { lexer::token_type::identifier, UR"(int)", { 17, 20 } } },
+                        identifier{ { 17, 20 }, { lexer::token_type::identifier, R"(int)", { 17, 20 } } },
                         std::nullopt,
                         {} } }),
                 std::nullopt } } } },
         &parse_struct_literal));
 
 MAYFLY_ADD_TESTCASE("multiple member literal",
-    test(UR"(struct { let i : int; let j = 1; };)",
+    test(R"(struct { let i : int; let j = 1; };)",
         struct_literal{ { 0, 34 },
             { { declaration{ { 9, 20 },
                   std::nullopt,
-                  { { 13, 14 }, { lexer::token_type::identifier, UR"(i)", { 13, 14 } } },
+                  { { 13, 14 }, { lexer::token_type::identifier, R"(i)", { 13, 14 } } },
                   std::make_optional<expression>({ { 17, 20 },
                       postfix_expression{ { 17, 20 },
-                          identifier{ { 17, 20 }, { lexer::token_type::identifier, UR"(int)", { 17, 20 } } },
+                          identifier{ { 17, 20 }, { lexer::token_type::identifier, R"(int)", { 17, 20 } } },
                           std::nullopt,
                           {} } }),
                   std::nullopt } },
                 { declaration{ { 22, 31 },
                     std::nullopt,
-                    { { 26, 27 }, { lexer::token_type::identifier, UR"(j)", { 26, 27 } } },
+                    { { 26, 27 }, { lexer::token_type::identifier, R"(j)", { 26, 27 } } },
                     std::nullopt,
                     std::make_optional<expression>({ { 30, 31 },
                         integer_literal{ { 30, 31 },
-                            { lexer::token_type::integer, UR"(1)", { 30, 31 } },
+                            { lexer::token_type::integer, R"(1)", { 30, 31 } },
                             {} } }) } } } },
         &parse_struct_literal));
 
 MAYFLY_ADD_TESTCASE("empty declaration",
-    test(UR"(struct foo {};)",
+    test(R"(struct foo {};)",
         declaration{ { 0, 13 },
             std::nullopt,
-            { { 7, 10 }, { lexer::token_type::identifier, UR"(foo)", { 7, 10 } } },
+            { { 7, 10 }, { lexer::token_type::identifier, R"(foo)", { 7, 10 } } },
             std::nullopt,
             std::make_optional<expression>({ { 0, 13 }, struct_literal{ { 0, 13 }, {} } }) },
         &parse_struct_declaration));
 
 MAYFLY_ADD_TESTCASE("single member declaration",
-    test(UR"(struct foo { let i : int; };)",
+    test(R"(struct foo { let i : int; };)",
         declaration{ { 0, 27 },
             std::nullopt,
-            { { 7, 10 }, { lexer::token_type::identifier, UR"(foo)", { 7, 10 } } },
+            { { 7, 10 }, { lexer::token_type::identifier, R"(foo)", { 7, 10 } } },
             std::nullopt,
             std::make_optional<expression>({ { 0, 27 },
                 struct_literal{ { 0, 27 },
                     { { declaration{ { 13, 24 },
                         std::nullopt,
-                        { { 17, 18 }, { lexer::token_type::identifier, UR"(i)", { 17, 18 } } },
+                        { { 17, 18 }, { lexer::token_type::identifier, R"(i)", { 17, 18 } } },
                         std::make_optional<expression>({ { 21, 24 },
                             postfix_expression{ { 21, 24 },
                                 identifier{ { 21, 24 },
-                                    { lexer::token_type::identifier, UR"(int)", { 21, 24 } } },
+                                    { lexer::token_type::identifier, R"(int)", { 21, 24 } } },
                                 std::nullopt,
                                 {} } }),
                         std::nullopt } } } } }) },
         &parse_struct_declaration));
 
 MAYFLY_ADD_TESTCASE("multiple member declaration",
-    test(UR"(struct foo { let i : int; let j = 1; };)",
+    test(R"(struct foo { let i : int; let j = 1; };)",
         declaration{ { 0, 38 },
             std::nullopt,
-            { { 7, 10 }, { lexer::token_type::identifier, UR"(foo)", { 7, 10 } } },
+            { { 7, 10 }, { lexer::token_type::identifier, R"(foo)", { 7, 10 } } },
             std::nullopt,
             std::make_optional<expression>({ { 0, 38 },
                 struct_literal{ { 0, 38 },
                     { { declaration{ { 13, 24 },
                           std::nullopt,
-                          { { 17, 18 }, { lexer::token_type::identifier, UR"(i)", { 17, 18 } } },
+                          { { 17, 18 }, { lexer::token_type::identifier, R"(i)", { 17, 18 } } },
                           std::make_optional<expression>({ { 21, 24 },
                               postfix_expression{ { 21, 24 },
                                   identifier{ { 21, 24 },
-                                      { lexer::token_type::identifier, UR"(int)", { 21, 24 } } },
+                                      { lexer::token_type::identifier, R"(int)", { 21, 24 } } },
                                   std::nullopt,
                                   {} } }),
                           std::nullopt } },
                         { declaration{ { 26, 35 },
                             std::nullopt,
-                            { { 30, 31 }, { lexer::token_type::identifier, UR"(j)", { 30, 31 } } },
+                            { { 30, 31 }, { lexer::token_type::identifier, R"(j)", { 30, 31 } } },
                             std::nullopt,
                             std::make_optional<expression>({ { 34, 35 },
                                 integer_literal{ { 34, 35 },
-                                    { lexer::token_type::integer, UR"(1)", { 34, 35 } },
+                                    { lexer::token_type::integer, R"(1)", { 34, 35 } },
                                     {} } }) } } } } }) },
         &parse_struct_declaration));
 